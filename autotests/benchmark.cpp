@@ -1,88 +1,396 @@
 /*
     This file is part of LibSyndication.
     SPDX-FileCopyrightText: 2006 Frank Osterfeld <osterfeld@kde.org>
+    SPDX-FileCopyrightText: 2026 KDE Community
 
     SPDX-License-Identifier: GPL-2.0-or-later WITH Qt-Commercial-exception-1.0
 */
 
+#include "category.h"
 #include "documentsource.h"
+#include "enclosure.h"
 #include "feed.h"
-#include "parsercollection.h"
+#include "global.h"
+#include "image.h"
+#include "item.h"
+#include "parsercollectionimpl.h"
+#include "person.h"
 #include "specificdocument.h"
 
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
-#include <QString>
-#include <QStringList>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QTextStream>
-#include <QTime>
 
-#include <cstdio>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
 #include <iostream>
 
 using namespace Syndication;
 
-int main(int argc, char **argv)
+namespace
+{
+std::atomic<quint64> allocationCount{0};
+std::atomic<quint64> allocatedBytes{0};
+
+void countAllocation(size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+} // namespace
+
+#if defined(SYNDICATION_BENCHMARK_WRAP_MALLOC) && defined(__GLIBC__)
+// Count all heap allocations, including those of Qt containers, which do
+// not go through operator new. Only glibc allows wrapping malloc like this,
+// and it clashes with sanitizers, so it is enabled with the CMake option
+// BENCHMARK_COUNT_ALLOCATIONS.
+#define SYNDICATION_BENCHMARK_COUNTS_ALLOCATIONS 1
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void __libc_free(void *ptr);
+
+void *malloc(size_t size) __THROW
+{
+    countAllocation(size);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) __THROW
+{
+    countAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) __THROW
+{
+    countAllocation(size);
+    return __libc_realloc(ptr, size);
+}
+
+void *memalign(size_t alignment, size_t size) __THROW
+{
+    countAllocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) __THROW
 {
-    QString filename(argv[1]);
-    QString arg1(argv[1]);
+    countAllocation(size);
+    return __libc_memalign(alignment, size);
+}
 
-    /*
-    if (filename == "--specific-format")
+int posix_memalign(void **ptr, size_t alignment, size_t size) __THROW
+{
+    if (alignment == 0 || alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    countAllocation(size);
+    void *result = __libc_memalign(alignment, size);
+    if (!result && size != 0) {
+        return ENOMEM;
+    }
+    *ptr = result;
+    return 0;
+}
+
+void free(void *ptr) __THROW
+{
+    __libc_free(ptr);
+}
+}
+#else
+#define SYNDICATION_BENCHMARK_COUNTS_ALLOCATIONS 0
+#endif
+
+namespace
+{
+enum Stage {
+    DomStage,
+    AcceptStage,
+    ParseStage,
+    MapStage,
+    AccessorStage,
+    StageCount,
+};
+
+const char *const stageNames[StageCount] = {"dom", "accept", "parse", "map", "accessors"};
+
+struct StageResult {
+    qint64 nsecs = 0;
+    quint64 allocations = 0;
+    quint64 allocatedBytes = 0;
+};
+
+struct FormatResult {
+    QString corpus;
+    QString format;
+    int files = 0;
+    qint64 bytes = 0;
+    qint64 items = 0;
+    StageResult stages[StageCount];
+};
+
+// time and allocations between start() and stop()
+class Measurement
+{
+public:
+    void start()
     {
-        if (argc < 3)
-        {
-            printUsage("filename expected");
-            return 1;
-        }
-        filename = QString(argv[2]);
-        specificformat = true;
+        m_allocations = allocationCount.load(std::memory_order_relaxed);
+        m_bytes = allocatedBytes.load(std::memory_order_relaxed);
+        m_timer.start();
+    }
+
+    void stop(StageResult &result)
+    {
+        result.nsecs += m_timer.nsecsElapsed();
+        result.allocations += allocationCount.load(std::memory_order_relaxed) - m_allocations;
+        result.allocatedBytes += allocatedBytes.load(std::memory_order_relaxed) - m_bytes;
     }
-    */
 
-    int totalLength = 0;
-    int numberOfFiles = 0;
+private:
+    QElapsedTimer m_timer;
+    quint64 m_allocations = 0;
+    quint64 m_bytes = 0;
+};
+
+// a representative set of accessor calls, as done by an aggregator
+// showing the feed
+qsizetype readFeed(const FeedPtr &feed)
+{
+    qsizetype sink = feed->title().size() + feed->link().size() + feed->description().size();
+    sink += feed->authors().size() + feed->categories().size();
+    const ImagePtr image = feed->image();
+    if (image) {
+        sink += image->url().size();
+    }
+
+    const QList<ItemPtr> items = feed->items();
+    for (const ItemPtr &item : items) {
+        sink += item->title().size() + item->link().size() + item->description().size() + item->content().size() + item->id().size();
+        sink += item->datePublished() != 0;
+        sink += item->dateUpdated() != 0;
+        const QList<PersonPtr> authors = item->authors();
+        for (const PersonPtr &person : authors) {
+            sink += person->name().size();
+        }
+        const QList<EnclosurePtr> enclosures = item->enclosures();
+        for (const EnclosurePtr &enclosure : enclosures) {
+            sink += enclosure->url().size();
+        }
+        const QList<CategoryPtr> categories = item->categories();
+        for (const CategoryPtr &category : categories) {
+            sink += category->term().size();
+        }
+    }
+    return sink;
+}
 
-    QStringList filenames;
+bool isStreamFormat(const QString &format)
+{
+    return format.endsWith(QLatin1String("stream"));
+}
 
-    QFile input(arg1);
-    input.open(QIODevice::ReadOnly);
-    QTextStream stream(&input);
+FormatResult benchmarkFormat(const QString &corpus, const QStringList &files, const QString &format, int iterations)
+{
+    const auto *collection = static_cast<ParserCollectionImpl<Feed> *>(parserCollection());
+    const AbstractParser *parser = collection->parser(format);
+    const Mapper<Feed> *mapper = collection->mapper(format);
 
-    while (!stream.atEnd()) {
-        filenames += stream.readLine();
+    FormatResult result;
+    result.corpus = corpus;
+    result.format = format;
+    if (!parser || !mapper) {
+        return result;
     }
-    input.close();
 
-    QTime time;
-    time.start();
+    const QString url = QStringLiteral("http://libsyndicationtest");
+    Measurement measurement;
+    volatile qsizetype sink = 0;
 
-    for (const QString &filename : std::as_const(filenames)) {
-        QFile f(filename);
+    for (const QString &path : files) {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        const QByteArray data = file.readAll();
 
-        if (!f.open(QIODevice::ReadOnly)) {
+        // only files of this format count
+        const DocumentSource probe(data, url);
+        if (!parser->accept(probe)) {
+            continue;
+        }
+        const SpecificDocumentPtr probeDocument = parser->parse(probe);
+        if (!probeDocument->isValid()) {
             continue;
         }
+        ++result.files;
+        result.bytes += data.size();
+        result.items += mapper->map(probeDocument)->items().size();
+
+        for (int i = 0; i < iterations; ++i) {
+            const DocumentSource source(data, url);
+            if (!isStreamFormat(format)) {
+                measurement.start();
+                sink = sink + source.asDomDocument().isNull();
+                measurement.stop(result.stages[DomStage]);
+            }
+
+            measurement.start();
+            sink = sink + parser->accept(source);
+            measurement.stop(result.stages[AcceptStage]);
 
-        DocumentSource src(f.readAll(), "http://libsyndicationtest");
-        f.close();
+            measurement.start();
+            const SpecificDocumentPtr document = parser->parse(source);
+            measurement.stop(result.stages[ParseStage]);
 
-        FeedPtr ptr(Syndication::parse(src));
-        if (ptr) {
-            totalLength += src.size();
-            ++numberOfFiles;
-            QString dbg = ptr->debugInfo();
+            measurement.start();
+            const FeedPtr feed = mapper->map(document);
+            measurement.stop(result.stages[MapStage]);
+
+            measurement.start();
+            sink = sink + readFeed(feed);
+            measurement.stop(result.stages[AccessorStage]);
         }
+    }
+
+    for (StageResult &stage : result.stages) {
+        stage.nsecs /= iterations;
+        stage.allocations /= iterations;
+        stage.allocatedBytes /= iterations;
+    }
+    return result;
+}
 
-        // std::cerr << "size of debug output: " << dbg.length() << std::endl;
+QJsonObject toJson(const FormatResult &result)
+{
+    QJsonObject stages;
+    for (int i = 0; i < StageCount; ++i) {
+        if (i == DomStage && isStreamFormat(result.format)) {
+            continue;
+        }
+        const StageResult &stage = result.stages[i];
+        QJsonObject object;
+        object.insert(QStringLiteral("nsecs"), stage.nsecs);
+        object.insert(QStringLiteral("allocations"), qint64(stage.allocations));
+        object.insert(QStringLiteral("allocatedBytes"), qint64(stage.allocatedBytes));
+        stages.insert(QLatin1String(stageNames[i]), object);
     }
 
-    int timeSpent = time.elapsed();
+    QJsonObject object;
+    object.insert(QStringLiteral("corpus"), result.corpus);
+    object.insert(QStringLiteral("format"), result.format);
+    object.insert(QStringLiteral("files"), result.files);
+    object.insert(QStringLiteral("bytes"), result.bytes);
+    object.insert(QStringLiteral("items"), result.items);
+    object.insert(QStringLiteral("stages"), stages);
+    return object;
+}
 
-    std::cout << "total number of files: " << numberOfFiles << std::endl;
-    std::cout << "total length of source (bytes): " << totalLength << std::endl;
-    std::cout << "avg length (bytes): " << (double)totalLength / numberOfFiles << std::endl;
-    std::cout << "time needed in total (ms): " << timeSpent << std::endl;
-    std::cout << "source bytes per second: " << (totalLength * 1000.0) / timeSpent << std::endl;
-    std::cout << "files per second: " << ((double)numberOfFiles * 1000) / timeSpent << std::endl;
+void writeCsv(QTextStream &out, const QList<FormatResult> &results)
+{
+    out << "corpus,format,stage,files,bytes,items,nsecs,allocations,allocatedBytes\n";
+    for (const FormatResult &result : results) {
+        for (int i = 0; i < StageCount; ++i) {
+            if (i == DomStage && isStreamFormat(result.format)) {
+                continue;
+            }
+            const StageResult &stage = result.stages[i];
+            out << result.corpus << ',' << result.format << ',' << stageNames[i] << ',' << result.files << ',' << result.bytes << ',' << result.items << ','
+                << stage.nsecs << ',' << stage.allocations << ',' << stage.allocatedBytes << '\n';
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser options;
+    options.setApplicationDescription(
+        QStringLiteral("Times the stages of parsing the feeds in the given directories: building the DOM, "
+                       "accept(), parse(), map() and reading the feed. Reports the average time and heap "
+                       "allocations of one iteration over all files, per directory and format. Allocations are "
+                       "only counted if built with the CMake option BENCHMARK_COUNT_ALLOCATIONS."));
+    options.addHelpOption();
+    const QCommandLineOption iterationsOption(QStringLiteral("iterations"), QStringLiteral("Number of runs over each file (default 10)."), QStringLiteral("n"));
+    const QCommandLineOption csvOption(QStringLiteral("csv"), QStringLiteral("Write CSV instead of JSON."));
+    const QCommandLineOption formatOption(QStringLiteral("format"),
+                                          QStringLiteral("Format to benchmark, may be given several times (default: all)."),
+                                          QStringLiteral("format"));
+    options.addOption(iterationsOption);
+    options.addOption(csvOption);
+    options.addOption(formatOption);
+    options.addPositionalArgument(QStringLiteral("directories"), QStringLiteral("Directories with *.xml feeds (default: the atom, rdf and rss2 test data)."));
+    options.process(app);
+
+    bool ok = true;
+    const int iterations = options.isSet(iterationsOption) ? options.value(iterationsOption).toInt(&ok) : 10;
+    if (!ok || iterations < 1) {
+        std::cerr << "invalid number of iterations" << std::endl;
+        return 1;
+    }
+
+    QStringList directories = options.positionalArguments();
+    if (directories.isEmpty()) {
+        for (const char *corpus : {"atom", "rdf", "rss2"}) {
+            directories.append(QStringLiteral(SYNDICATION_DATA_DIR "/") + QLatin1String(corpus));
+        }
+    }
+
+    QStringList formats = options.values(formatOption);
+    if (formats.isEmpty()) {
+        formats = {QStringLiteral("rss2"), QStringLiteral("rss2stream"), QStringLiteral("atom"), QStringLiteral("atomstream"), QStringLiteral("rdf")};
+    }
+
+    QList<FormatResult> results;
+    for (const QString &directory : std::as_const(directories)) {
+        const QDir dir(directory);
+        QStringList files;
+        const QStringList names = dir.entryList({QStringLiteral("*.xml")}, QDir::Files, QDir::Name);
+        for (const QString &name : names) {
+            files.append(dir.filePath(name));
+        }
+
+        for (const QString &format : std::as_const(formats)) {
+            const FormatResult result = benchmarkFormat(dir.dirName(), files, format, iterations);
+            if (result.files > 0) {
+                results.append(result);
+            }
+        }
+    }
+
+    if (results.isEmpty()) {
+        std::cerr << "no feeds found" << std::endl;
+        return 1;
+    }
+
+    QTextStream out(stdout);
+    if (options.isSet(csvOption)) {
+        writeCsv(out, results);
+    } else {
+        QJsonArray array;
+        for (const FormatResult &result : std::as_const(results)) {
+            array.append(toJson(result));
+        }
+        QJsonObject object;
+        object.insert(QStringLiteral("iterations"), iterations);
+        object.insert(QStringLiteral("allocationsCounted"), bool(SYNDICATION_BENCHMARK_COUNTS_ALLOCATIONS));
+        object.insert(QStringLiteral("results"), array);
+        out << QJsonDocument(object).toJson();
+    }
     return 0;
 }
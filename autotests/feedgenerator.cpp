@@ -0,0 +1,235 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "feedgenerator.h"
+
+#include <QDateTime>
+#include <QString>
+#include <QTimeZone>
+#include <QXmlStreamWriter>
+
+#include <cmath>
+#include <functional>
+
+namespace
+{
+const QString atomNs = QStringLiteral("http://www.w3.org/2005/Atom");
+const QString rdfNs = QStringLiteral("http://www.w3.org/1999/02/22-rdf-syntax-ns#");
+const QString rss1Ns = QStringLiteral("http://purl.org/rss/1.0/");
+const QString dcNs = QStringLiteral("http://purl.org/dc/elements/1.1/");
+const QString contentNs = QStringLiteral("http://purl.org/rss/1.0/modules/content/");
+const QString slashNs = QStringLiteral("http://purl.org/rss/1.0/modules/slash/");
+const QString extNs = QStringLiteral("http://example.com/syndication/ext");
+
+QString itemUrl(int index)
+{
+    return QStringLiteral("http://example.com/items/%1").arg(index);
+}
+
+QDateTime itemDate(int index)
+{
+    // one item per minute, newest first
+    return QDateTime(QDate(2026, 1, 1), QTime(12, 0), QTimeZone::UTC).addSecs(-60 * index);
+}
+
+QString itemDescription(int index)
+{
+    return QStringLiteral("<p>Description of <b>item %1</b>, with some markup &amp; text to read.</p>").arg(index);
+}
+
+QString itemContent(int index)
+{
+    return QStringLiteral("<div><p>Content of item %1.</p><p><a href=\"%2\">Read more</a></p></div>").arg(index).arg(itemUrl(index));
+}
+
+// an element the parsers do not know, ending up in additionalProperties()
+void writeExtensionData(QXmlStreamWriter &writer, int index)
+{
+    writer.writeStartElement(extNs, QStringLiteral("data"));
+    writer.writeAttribute(QStringLiteral("id"), QString::number(index));
+    writer.writeTextElement(extNs, QStringLiteral("value"), QStringLiteral("Value %1").arg(index));
+    writer.writeEndElement();
+}
+
+void writeRss2(QXmlStreamWriter &writer, int itemCount, const std::function<bool(int)> &hasExtensions)
+{
+    writer.writeNamespace(dcNs, QStringLiteral("dc"));
+    writer.writeNamespace(contentNs, QStringLiteral("content"));
+    writer.writeNamespace(slashNs, QStringLiteral("slash"));
+    writer.writeNamespace(extNs, QStringLiteral("ext"));
+    writer.writeStartElement(QStringLiteral("rss"));
+    writer.writeAttribute(QStringLiteral("version"), QStringLiteral("2.0"));
+    writer.writeStartElement(QStringLiteral("channel"));
+    writer.writeTextElement(QStringLiteral("title"), QStringLiteral("Generated feed"));
+    writer.writeTextElement(QStringLiteral("link"), QStringLiteral("http://example.com/"));
+    writer.writeTextElement(QStringLiteral("description"), QStringLiteral("A feed with %1 items").arg(itemCount));
+
+    for (int i = 0; i < itemCount; ++i) {
+        writer.writeStartElement(QStringLiteral("item"));
+        writer.writeTextElement(QStringLiteral("title"), QStringLiteral("Item %1").arg(i));
+        writer.writeTextElement(QStringLiteral("link"), itemUrl(i));
+        writer.writeStartElement(QStringLiteral("guid"));
+        writer.writeAttribute(QStringLiteral("isPermaLink"), QStringLiteral("false"));
+        writer.writeCharacters(QStringLiteral("item-%1").arg(i));
+        writer.writeEndElement();
+        writer.writeTextElement(QStringLiteral("description"), itemDescription(i));
+        writer.writeTextElement(QStringLiteral("pubDate"), itemDate(i).toString(Qt::RFC2822Date));
+        if (hasExtensions(i)) {
+            writer.writeTextElement(dcNs, QStringLiteral("creator"), QStringLiteral("Author %1").arg(i % 10));
+            writer.writeTextElement(QStringLiteral("category"), QStringLiteral("Category %1").arg(i % 7));
+            writer.writeTextElement(QStringLiteral("category"), QStringLiteral("Tag %1").arg(i % 13));
+            writer.writeEmptyElement(QStringLiteral("enclosure"));
+            writer.writeAttribute(QStringLiteral("url"), itemUrl(i) + QLatin1String(".mp3"));
+            writer.writeAttribute(QStringLiteral("length"), QString::number(1000 + i));
+            writer.writeAttribute(QStringLiteral("type"), QStringLiteral("audio/mpeg"));
+            writer.writeTextElement(contentNs, QStringLiteral("encoded"), itemContent(i));
+            writer.writeTextElement(slashNs, QStringLiteral("comments"), QString::number(i % 50));
+            writeExtensionData(writer, i);
+        }
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+    writer.writeEndElement();
+}
+
+void writeAtom(QXmlStreamWriter &writer, int itemCount, const std::function<bool(int)> &hasExtensions)
+{
+    writer.writeDefaultNamespace(atomNs);
+    writer.writeNamespace(extNs, QStringLiteral("ext"));
+    writer.writeStartElement(atomNs, QStringLiteral("feed"));
+    writer.writeTextElement(atomNs, QStringLiteral("title"), QStringLiteral("Generated feed"));
+    writer.writeTextElement(atomNs, QStringLiteral("id"), QStringLiteral("tag:example.com,2026:feed"));
+    writer.writeTextElement(atomNs, QStringLiteral("updated"), itemDate(0).toString(Qt::ISODate));
+    writer.writeEmptyElement(atomNs, QStringLiteral("link"));
+    writer.writeAttribute(QStringLiteral("href"), QStringLiteral("http://example.com/"));
+    writer.writeStartElement(atomNs, QStringLiteral("author"));
+    writer.writeTextElement(atomNs, QStringLiteral("name"), QStringLiteral("Feed Author"));
+    writer.writeEndElement();
+
+    for (int i = 0; i < itemCount; ++i) {
+        writer.writeStartElement(atomNs, QStringLiteral("entry"));
+        writer.writeTextElement(atomNs, QStringLiteral("id"), QStringLiteral("tag:example.com,2026:item-%1").arg(i));
+        writer.writeTextElement(atomNs, QStringLiteral("title"), QStringLiteral("Item %1").arg(i));
+        writer.writeEmptyElement(atomNs, QStringLiteral("link"));
+        writer.writeAttribute(QStringLiteral("href"), itemUrl(i));
+        writer.writeTextElement(atomNs, QStringLiteral("updated"), itemDate(i).toString(Qt::ISODate));
+        writer.writeStartElement(atomNs, QStringLiteral("summary"));
+        writer.writeAttribute(QStringLiteral("type"), QStringLiteral("html"));
+        writer.writeCharacters(itemDescription(i));
+        writer.writeEndElement();
+        if (hasExtensions(i)) {
+            writer.writeStartElement(atomNs, QStringLiteral("author"));
+            writer.writeTextElement(atomNs, QStringLiteral("name"), QStringLiteral("Author %1").arg(i % 10));
+            writer.writeEndElement();
+            writer.writeEmptyElement(atomNs, QStringLiteral("category"));
+            writer.writeAttribute(QStringLiteral("term"), QStringLiteral("Category %1").arg(i % 7));
+            writer.writeEmptyElement(atomNs, QStringLiteral("category"));
+            writer.writeAttribute(QStringLiteral("term"), QStringLiteral("Tag %1").arg(i % 13));
+            writer.writeEmptyElement(atomNs, QStringLiteral("link"));
+            writer.writeAttribute(QStringLiteral("rel"), QStringLiteral("enclosure"));
+            writer.writeAttribute(QStringLiteral("href"), itemUrl(i) + QLatin1String(".mp3"));
+            writer.writeAttribute(QStringLiteral("length"), QString::number(1000 + i));
+            writer.writeAttribute(QStringLiteral("type"), QStringLiteral("audio/mpeg"));
+            writer.writeStartElement(atomNs, QStringLiteral("content"));
+            writer.writeAttribute(QStringLiteral("type"), QStringLiteral("html"));
+            writer.writeCharacters(itemContent(i));
+            writer.writeEndElement();
+            writeExtensionData(writer, i);
+        }
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+}
+
+void writeRdf(QXmlStreamWriter &writer, int itemCount, const std::function<bool(int)> &hasExtensions)
+{
+    writer.writeNamespace(rdfNs, QStringLiteral("rdf"));
+    writer.writeDefaultNamespace(rss1Ns);
+    writer.writeNamespace(dcNs, QStringLiteral("dc"));
+    writer.writeNamespace(contentNs, QStringLiteral("content"));
+    writer.writeNamespace(extNs, QStringLiteral("ext"));
+    writer.writeStartElement(rdfNs, QStringLiteral("RDF"));
+
+    writer.writeStartElement(rss1Ns, QStringLiteral("channel"));
+    writer.writeAttribute(rdfNs, QStringLiteral("about"), QStringLiteral("http://example.com/"));
+    writer.writeTextElement(rss1Ns, QStringLiteral("title"), QStringLiteral("Generated feed"));
+    writer.writeTextElement(rss1Ns, QStringLiteral("link"), QStringLiteral("http://example.com/"));
+    writer.writeTextElement(rss1Ns, QStringLiteral("description"), QStringLiteral("A feed with %1 items").arg(itemCount));
+    writer.writeStartElement(rss1Ns, QStringLiteral("items"));
+    writer.writeStartElement(rdfNs, QStringLiteral("Seq"));
+    for (int i = 0; i < itemCount; ++i) {
+        writer.writeEmptyElement(rdfNs, QStringLiteral("li"));
+        writer.writeAttribute(rdfNs, QStringLiteral("resource"), itemUrl(i));
+    }
+    writer.writeEndElement();
+    writer.writeEndElement();
+    writer.writeEndElement();
+
+    for (int i = 0; i < itemCount; ++i) {
+        writer.writeStartElement(rss1Ns, QStringLiteral("item"));
+        writer.writeAttribute(rdfNs, QStringLiteral("about"), itemUrl(i));
+        writer.writeTextElement(rss1Ns, QStringLiteral("title"), QStringLiteral("Item %1").arg(i));
+        writer.writeTextElement(rss1Ns, QStringLiteral("link"), itemUrl(i));
+        writer.writeTextElement(rss1Ns, QStringLiteral("description"), itemDescription(i));
+        writer.writeTextElement(dcNs, QStringLiteral("date"), itemDate(i).toString(Qt::ISODate));
+        if (hasExtensions(i)) {
+            writer.writeTextElement(dcNs, QStringLiteral("creator"), QStringLiteral("Author %1").arg(i % 10));
+            writer.writeTextElement(dcNs, QStringLiteral("subject"), QStringLiteral("Category %1").arg(i % 7));
+            writer.writeTextElement(contentNs, QStringLiteral("encoded"), itemContent(i));
+            writeExtensionData(writer, i);
+        }
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+}
+
+} // namespace
+
+FeedGenerator::FeedGenerator(Format format)
+    : m_format(format)
+{
+}
+
+void FeedGenerator::setItemCount(int count)
+{
+    m_itemCount = count;
+}
+
+void FeedGenerator::setExtensionDensity(double density)
+{
+    m_extensionDensity = qBound(0.0, density, 1.0);
+}
+
+QByteArray FeedGenerator::generate() const
+{
+    // spreads the items with extensions evenly over the feed
+    const double density = m_extensionDensity;
+    const std::function<bool(int)> hasExtensions = [density](int index) {
+        return std::floor((index + 1) * density) > std::floor(index * density);
+    };
+
+    QByteArray data;
+    QXmlStreamWriter writer(&data);
+    writer.setAutoFormatting(true);
+    writer.writeStartDocument();
+    switch (m_format) {
+    case RSS2:
+        writeRss2(writer, m_itemCount, hasExtensions);
+        break;
+    case Atom:
+        writeAtom(writer, m_itemCount, hasExtensions);
+        break;
+    case RDF:
+        writeRdf(writer, m_itemCount, hasExtensions);
+        break;
+    }
+    writer.writeEndDocument();
+    return data;
+}
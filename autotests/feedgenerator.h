@@ -0,0 +1,51 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_TESTS_FEEDGENERATOR_H
+#define SYNDICATION_TESTS_FEEDGENERATOR_H
+
+#include <QByteArray>
+
+/*!
+ * Generates synthetic feeds of arbitrary size, to test how parsing scales
+ * with the number of items. The output is deterministic.
+ */
+class FeedGenerator
+{
+public:
+    enum Format {
+        RSS2,
+        Atom,
+        RDF, // RSS 1.0
+    };
+
+    explicit FeedGenerator(Format format);
+
+    /*!
+     * sets the number of items (entries) to generate, 10 by default
+     */
+    void setItemCount(int count);
+
+    /*!
+     * Sets the fraction of items, from 0.0 to 1.0, that carry extension
+     * elements: authors, categories, enclosures, content:encoded, comment
+     * counts and elements of an unknown namespace. 0.5 by default.
+     */
+    void setExtensionDensity(double density);
+
+    /*!
+     * returns the feed document
+     */
+    QByteArray generate() const;
+
+private:
+    Format m_format;
+    int m_itemCount = 10;
+    double m_extensionDensity = 0.5;
+};
+
+#endif // SYNDICATION_TESTS_FEEDGENERATOR_H
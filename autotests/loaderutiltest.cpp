@@ -42,4 +42,49 @@ void LoaderUtilTest::testParsing()
     QCOMPARE(Syndication::LoaderUtil::parseFeed(ba, url), urlfound);
 }
 
+void LoaderUtilTest::testCandidates()
+{
+    QFile f(QStringLiteral(SYNDICATION_DATA_FEEDPARSING_DIR) + QStringLiteral("/bug-test-gentoo.txt"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    const auto candidates = Syndication::LoaderUtil::feedCandidates(f.readAll(), QUrl(QStringLiteral("https://planet.gentoo.org")));
+    QCOMPARE(candidates.size(), 4);
+    QCOMPARE(candidates.at(0).url, QUrl(QStringLiteral("https://planet.gentoo.org/rss20.xml")));
+    QCOMPARE(candidates.at(0).type, QStringLiteral("application/rss+xml"));
+    QCOMPARE(candidates.at(0).title, QStringLiteral("Planet Gentoo"));
+    QCOMPARE(candidates.at(1).url, QUrl(QStringLiteral("https://planet.gentoo.org/universe/rss20.xml")));
+    QCOMPARE(candidates.at(2).url, QUrl(QStringLiteral("https://planet.gentoo.org/atom.xml")));
+    QCOMPARE(candidates.at(2).type, QStringLiteral("application/atom+xml"));
+    QCOMPARE(candidates.at(3).url, QUrl(QStringLiteral("https://planet.gentoo.org/universe/atom.xml")));
+}
+
+void LoaderUtilTest::testAnchorCandidates()
+{
+    const QByteArray html(
+        "<!DOCTYPE html><html><head><title>Blog</title>"
+        "<script>if (a<b) document.write('<link rel=\"alternate\" type=\"application/rss+xml\" href=\"/script.xml\">');</script>"
+        "<LINK REL=\"Alternate\" TYPE=\"application/atom+xml\" HREF=\"feed.atom?a=1&amp;b=2\" TITLE=\"Atom\">"
+        "<link rel=alternate hreflang=de href=/de/>"
+        "</head><body>"
+        "<a href=\"https://elsewhere.example.org/news.rss\">other</a>"
+        "<a href='/comments.xml'>comments</a>"
+        "<a href=\"/about.html\">about</a>"
+        "</body></html>");
+    const QUrl url(QStringLiteral("https://blog.example.org/posts/"));
+
+    const auto candidates = Syndication::LoaderUtil::feedCandidates(html, url);
+    QCOMPARE(candidates.size(), 1);
+    QCOMPARE(candidates.at(0).url, QUrl(QStringLiteral("https://blog.example.org/posts/feed.atom?a=1&b=2")));
+    QCOMPARE(candidates.at(0).title, QStringLiteral("Atom"));
+
+    // without alternate links, <a> links are used, same host first
+    QByteArray anchors = html;
+    anchors.replace("LINK", "META");
+    const auto fallback = Syndication::LoaderUtil::feedCandidates(anchors, url);
+    QCOMPARE(fallback.size(), 2);
+    QCOMPARE(fallback.at(0).url, QUrl(QStringLiteral("https://blog.example.org/comments.xml")));
+    QVERIFY(fallback.at(0).type.isEmpty());
+    QCOMPARE(fallback.at(1).url, QUrl(QStringLiteral("https://elsewhere.example.org/news.rss")));
+    QCOMPARE(Syndication::LoaderUtil::parseFeed(anchors, url), fallback.at(0).url);
+}
+
 #include "moc_loaderutiltest.cpp"
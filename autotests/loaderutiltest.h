@@ -19,6 +19,8 @@ public:
 private Q_SLOTS:
     void testParsing_data();
     void testParsing();
+    void testCandidates();
+    void testAnchorCandidates();
 };
 
 #endif // LOADERUTILTEST_H
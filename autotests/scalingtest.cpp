@@ -0,0 +1,163 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "scalingtest.h"
+#include "feedgenerator.h"
+
+#include "category.h"
+#include "documentsource.h"
+#include "enclosure.h"
+#include "feed.h"
+#include "global.h"
+#include "item.h"
+#include "person.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QTest>
+#include <QTimeZone>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+QTEST_GUILESS_MAIN(ScalingTest)
+
+using namespace Syndication;
+
+namespace
+{
+struct Timing {
+    qint64 parse = std::numeric_limits<qint64>::max();
+    qint64 accessors = std::numeric_limits<qint64>::max();
+};
+
+// the accessors an aggregator calls for every item
+qsizetype readFeed(const FeedPtr &feed)
+{
+    qsizetype sink = feed->title().size();
+    const QList<ItemPtr> items = feed->items();
+    for (const ItemPtr &item : items) {
+        sink += item->title().size() + item->link().size() + item->description().size() + item->content().size() + item->id().size();
+        sink += item->datePublished() != 0;
+        sink += item->authors().size() + item->categories().size() + item->enclosures().size();
+    }
+    return sink;
+}
+
+// best of three runs, to keep noise out of the comparison
+Timing measure(const QByteArray &data, const QString &formatHint)
+{
+    Timing best;
+    volatile qsizetype sink = 0;
+    for (int run = 0; run < 3; ++run) {
+        QElapsedTimer timer;
+        timer.start();
+        const FeedPtr feed = Syndication::parse(DocumentSource(data, QString()), formatHint);
+        const qint64 parse = timer.nsecsElapsed();
+
+        timer.restart();
+        sink = sink + (feed ? readFeed(feed) : 0);
+        const qint64 accessors = timer.nsecsElapsed();
+
+        best.parse = std::min(best.parse, parse);
+        best.accessors = std::min(best.accessors, accessors);
+    }
+    return best;
+}
+
+QByteArray generate(FeedGenerator::Format format, int items, double extensionDensity)
+{
+    FeedGenerator generator(format);
+    generator.setItemCount(items);
+    generator.setExtensionDensity(extensionDensity);
+    return generator.generate();
+}
+
+void addFormatRows()
+{
+    QTest::addColumn<int>("format");
+    QTest::addColumn<QString>("formatHint");
+
+    QTest::newRow("rss2") << int(FeedGenerator::RSS2) << QStringLiteral("rss2");
+    QTest::newRow("rss2stream") << int(FeedGenerator::RSS2) << QStringLiteral("rss2stream");
+    QTest::newRow("atom") << int(FeedGenerator::Atom) << QStringLiteral("atom");
+    QTest::newRow("atomstream") << int(FeedGenerator::Atom) << QStringLiteral("atomstream");
+    QTest::newRow("rdf") << int(FeedGenerator::RDF) << QStringLiteral("rdf");
+}
+
+} // namespace
+
+void ScalingTest::testGenerator_data()
+{
+    addFormatRows();
+}
+
+void ScalingTest::testGenerator()
+{
+    QFETCH(int, format);
+    QFETCH(QString, formatHint);
+
+    const FeedPtr feed = Syndication::parse(DocumentSource(generate(FeedGenerator::Format(format), 25, 0.2), QString()), formatHint);
+    QVERIFY(feed);
+
+    const QList<ItemPtr> items = feed->items();
+    QCOMPARE(items.size(), 25);
+    QCOMPARE(items.first()->title(), QStringLiteral("Item 0"));
+    QCOMPARE(items.first()->link(), QStringLiteral("http://example.com/items/0"));
+    QCOMPARE(qint64(items.at(3)->datePublished()), QDateTime(QDate(2026, 1, 1), QTime(11, 57), QTimeZone::UTC).toSecsSinceEpoch());
+
+    // every fifth item carries extensions, the others get the Atom feed author
+    const auto withAuthors = std::count_if(items.cbegin(), items.cend(), [](const ItemPtr &item) {
+        const QList<PersonPtr> authors = item->authors();
+        return !authors.isEmpty() && authors.first()->name().startsWith(QLatin1String("Author "));
+    });
+    QCOMPARE(int(withAuthors), 5);
+    QCOMPARE(items.at(4)->authors().first()->name(), QStringLiteral("Author 4"));
+}
+
+void ScalingTest::testScaling_data()
+{
+    addFormatRows();
+}
+
+void ScalingTest::testScaling()
+{
+    QFETCH(int, format);
+    QFETCH(QString, formatHint);
+
+    // wall-clock ratios are unreliable on loaded machines, which can skip them
+    // with SYNDICATION_SKIP_TIMING_TESTS or by excluding the ctest label "timing"
+    if (qEnvironmentVariableIsSet("SYNDICATION_SKIP_TIMING_TESTS")) {
+        QSKIP("SYNDICATION_SKIP_TIMING_TESTS is set");
+    }
+
+    // archive feeds can have 100k items, set SYNDICATION_SCALING_ITEMS to test these
+    const int small = 1000;
+    const int large = std::max(small * 2, qEnvironmentVariableIsSet("SYNDICATION_SCALING_ITEMS") ? qEnvironmentVariableIntValue("SYNDICATION_SCALING_ITEMS") : 8000);
+
+    const Timing smallTiming = measure(generate(FeedGenerator::Format(format), small, 0.5), formatHint);
+    const Timing largeTiming = measure(generate(FeedGenerator::Format(format), large, 0.5), formatHint);
+
+    // Linear growth takes (large / small) times as long, quadratic growth its
+    // square. Allow up to the power of 1.5 for noise and cache effects.
+    // Times below a millisecond are too noisy to compare.
+    const double growth = double(large) / small;
+    const double limit = std::pow(growth, 1.5);
+    const auto ratio = [](qint64 smallTime, qint64 largeTime) {
+        return double(largeTime) / std::max<qint64>(smallTime, 1000000);
+    };
+
+    const double parseRatio = ratio(smallTiming.parse, largeTiming.parse);
+    QVERIFY2(parseRatio <= limit,
+             qPrintable(QStringLiteral("parsing %1 times as many items took %2 times as long").arg(growth).arg(parseRatio)));
+    const double accessorRatio = ratio(smallTiming.accessors, largeTiming.accessors);
+    QVERIFY2(accessorRatio <= limit,
+             qPrintable(QStringLiteral("reading %1 times as many items took %2 times as long").arg(growth).arg(accessorRatio)));
+}
+
+#include "moc_scalingtest.cpp"
@@ -0,0 +1,24 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_TESTS_SCALINGTEST_H
+#define SYNDICATION_TESTS_SCALINGTEST_H
+
+#include <QObject>
+
+class ScalingTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testGenerator_data();
+    void testGenerator();
+    void testScaling_data();
+    void testScaling();
+};
+
+#endif // SYNDICATION_TESTS_SCALINGTEST_H
@@ -6,14 +6,33 @@
 */
 
 #include "syndicationtest.h"
+#include "atom/document.h"
+#include "atom/entry.h"
+#include "atom/link.h"
+#include "atom/person.h"
+#include "atom/streamreader.h"
+#include "dataretriever.h"
 #include "documentsource.h"
+#include "documentvisitor.h"
 #include "feed.h"
+#include "feeddiff.h"
+#include "feedsnapshot.h"
+#include "incrementalparser.h"
+#include "instrumentation.h"
+#include "item.h"
+#include "loader.h"
 #include "parsercollection.h"
 #include "specificdocument.h"
+#include "tools.h"
 
 #include <QByteArray>
+#include <QDomElement>
 #include <QDebug>
 #include <QFile>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QThreadPool>
+#include <QTimer>
 
 #include <QTest>
 QTEST_GUILESS_MAIN(SyndicationTest)
@@ -95,4 +114,945 @@ void SyndicationTest::testSyncationFile()
     QVERIFY(compare);
 }
 
+void SyndicationTest::testStreamingRss2_data()
+{
+    QTest::addColumn<QString>("fileName");
+
+    QDir dirRss2(QStringLiteral(SYNDICATION_DATA_DIR "/rss2"));
+    const auto l = dirRss2.entryList(QStringList(QStringLiteral("*.xml")), QDir::Files | QDir::Readable | QDir::NoSymLinks);
+    for (const QString &file : l) {
+        QTest::newRow(file.toLatin1().constData()) << QString(dirRss2.path() + QLatin1Char('/') + file);
+    }
+}
+
+void SyndicationTest::testStreamingRss2()
+{
+    QFETCH(QString, fileName);
+    QFile f(fileName);
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+
+    const QByteArray data = f.readAll();
+    f.close();
+
+    // embedded XHTML content is serialized differently than by QDom
+    if (data.contains("http://www.w3.org/1999/xhtml")) {
+        QSKIP("xhtml content serialization differs from the DOM parser");
+    }
+
+    FeedPtr domFeed(Syndication::parse(DocumentSource(data, QStringLiteral("http://libsyndicationtest"))));
+    FeedPtr streamFeed(Syndication::parse(DocumentSource(data, QStringLiteral("http://libsyndicationtest")), QStringLiteral("rss2stream")));
+    QVERIFY(domFeed);
+    QVERIFY(streamFeed);
+    QCOMPARE(streamFeed->specificDocument()->isValid(), true);
+
+    QCOMPARE(streamFeed->debugInfo().split(QLatin1Char('\n')), domFeed->debugInfo().split(QLatin1Char('\n')));
+    QCOMPARE(streamFeed->additionalProperties().keys(), domFeed->additionalProperties().keys());
+
+    const QList<ItemPtr> domItems = domFeed->items();
+    const QList<ItemPtr> streamItems = streamFeed->items();
+    QCOMPARE(streamItems.count(), domItems.count());
+    for (int i = 0; i < domItems.count(); ++i) {
+        const QMultiMap<QString, QDomElement> domProperties = domItems.at(i)->additionalProperties();
+        const QMultiMap<QString, QDomElement> streamProperties = streamItems.at(i)->additionalProperties();
+        QCOMPARE(streamProperties.keys(), domProperties.keys());
+        QCOMPARE(streamProperties.values().count(), domProperties.values().count());
+        for (auto it = streamProperties.cbegin(); it != streamProperties.cend(); ++it) {
+            QVERIFY(!it.value().isNull());
+        }
+    }
+}
+
+void SyndicationTest::testStreamingAtom_data()
+{
+    QTest::addColumn<QString>("fileName");
+    QTest::addColumn<QString>("referenceFileName");
+
+    QDir dir(QStringLiteral(SYNDICATION_DATA_DIR "/atom"));
+    const auto l = dir.entryList(QStringList(QStringLiteral("*.xml")), QDir::Files | QDir::Readable | QDir::NoSymLinks);
+    for (const QString &file : l) {
+        QTest::newRow(file.toLatin1().constData()) << QString(dir.path() + QLatin1Char('/') + file)
+                                                   << QString(dir.path() + QLatin1Char('/') + file + QLatin1String(".expected"));
+    }
+}
+
+void SyndicationTest::testStreamingAtom()
+{
+    QFETCH(QString, fileName);
+    QFETCH(QString, referenceFileName);
+    QFile f(fileName);
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+
+    DocumentSource src(f.readAll(), QStringLiteral("http://libsyndicationtest"));
+    f.close();
+
+    // Atom 0.3 documents are not accepted by the streaming parser and fall back to Atom::Parser
+    FeedPtr ptr(Syndication::parse(src, QStringLiteral("atomstream")));
+    QVERIFY(ptr);
+
+    QFile expFile(referenceFileName);
+    QVERIFY(expFile.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QByteArray expected = expFile.readAll();
+    expFile.close();
+
+    QCOMPARE(QString::fromUtf8(ptr->debugInfo().toUtf8().trimmed()).split(QLatin1Char('\n')), QString::fromUtf8(expected.trimmed()).split(QLatin1Char('\n')));
+}
+
+void SyndicationTest::testAtomEntryHandler()
+{
+    const QByteArray data = QByteArrayLiteral(
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+        "<feed xmlns=\"http://www.w3.org/2005/Atom\" xml:base=\"http://example.org/feed/\">\n"
+        "  <title>Example Feed</title>\n"
+        "  <author><name>Feed Author</name></author>\n"
+        "  <id>urn:uuid:60a76c80-d399-11d9-b93C-0003939e0af6</id>\n"
+        "  <entry>\n"
+        "    <title>First</title>\n"
+        "    <link href=\"first.html\"/>\n"
+        "    <id>urn:entry:1</id>\n"
+        "  </entry>\n"
+        "  <entry xml:base=\"sub/\">\n"
+        "    <title type=\"xhtml\"><div xmlns=\"http://www.w3.org/1999/xhtml\">Second <b>entry</b></div></title>\n"
+        "    <link href=\"second.html\"/>\n"
+        "    <author><name>Entry Author</name></author>\n"
+        "    <id>urn:entry:2</id>\n"
+        "  </entry>\n"
+        "</feed>\n");
+
+    QStringList ids;
+    QStringList links;
+    QStringList authors;
+    Atom::StreamReader reader;
+    reader.setEntryHandler([&](const Atom::Entry &entry) {
+        ids.append(entry.id());
+        links.append(entry.links().first().href());
+        authors.append(entry.authors().first().name());
+    });
+
+    // feed the document in small chunks, entries must be reported as soon as they are complete
+    for (int i = 0; i < data.size(); i += 7) {
+        reader.addData(data.mid(i, 7));
+        if (i > data.indexOf("</entry>") + 8) {
+            QVERIFY(!ids.isEmpty());
+        }
+    }
+
+    QVERIFY(!reader.hasError());
+    QVERIFY(reader.isComplete());
+    QCOMPARE(ids, QStringList({QStringLiteral("urn:entry:1"), QStringLiteral("urn:entry:2")}));
+    QCOMPARE(links, QStringList({QStringLiteral("http://example.org/feed/first.html"), QStringLiteral("http://example.org/feed/sub/second.html")}));
+    QCOMPARE(authors, QStringList({QStringLiteral("Feed Author"), QStringLiteral("Entry Author")}));
+
+    const Atom::FeedDocument feed = reader.feed();
+    QCOMPARE(feed.title(), QStringLiteral("Example Feed"));
+    QVERIFY(feed.entries().isEmpty());
+
+    Atom::StreamReader invalid;
+    invalid.addData(QByteArrayLiteral("<rss version=\"2.0\"><channel/></rss>"));
+    QVERIFY(invalid.hasError());
+}
+
+void SyndicationTest::testIncrementalParser_data()
+{
+    QTest::addColumn<QString>("fileName");
+    QTest::addColumn<int>("chunkSize");
+
+    const QStringList subDirs = {QStringLiteral("atom"), QStringLiteral("rdf"), QStringLiteral("rss2")};
+    for (const QString &subDir : subDirs) {
+        QDir dir(QStringLiteral(SYNDICATION_DATA_DIR "/") + subDir);
+        const auto l = dir.entryList(QStringList(QStringLiteral("*.xml")), QDir::Files | QDir::Readable | QDir::NoSymLinks);
+        for (const QString &file : l) {
+            QTest::newRow(QString(file + QLatin1String("-1")).toLatin1().constData()) << QString(dir.path() + QLatin1Char('/') + file) << 1;
+            QTest::newRow(QString(file + QLatin1String("-4096")).toLatin1().constData()) << QString(dir.path() + QLatin1Char('/') + file) << 4096;
+        }
+    }
+}
+
+void SyndicationTest::testIncrementalParser()
+{
+    QFETCH(QString, fileName);
+    QFETCH(int, chunkSize);
+    QFile f(fileName);
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+
+    const QByteArray data = f.readAll();
+    f.close();
+
+    if (data.contains("http://www.w3.org/1999/xhtml") && data.contains("<rss")) {
+        QSKIP("xhtml content serialization of the RSS2 streaming parser differs from the DOM parser");
+    }
+
+    IncrementalParser parser(QStringLiteral("http://libsyndicationtest"));
+    for (int i = 0; i < data.size(); i += chunkSize) {
+        parser.addData(data.mid(i, chunkSize));
+    }
+    QCOMPARE(parser.data(), data);
+
+    FeedPtr incremental = parser.finish();
+    QCOMPARE(parser.lastError(), Syndication::Success);
+    QVERIFY(incremental);
+
+    FeedPtr complete(Syndication::parse(DocumentSource(data, QStringLiteral("http://libsyndicationtest"))));
+    QVERIFY(complete);
+    QCOMPARE(incremental->debugInfo().split(QLatin1Char('\n')), complete->debugInfo().split(QLatin1Char('\n')));
+}
+
+void SyndicationTest::testParseDocumentErrors()
+{
+    ParseResult result = Syndication::parseDocument(DocumentSource(QByteArray("this is not xml <"), QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(!result.feed);
+    QCOMPARE(result.error, Syndication::InvalidXml);
+
+    result = Syndication::parseDocument(DocumentSource(QByteArray("<html><head/></html>"), QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(!result.feed);
+    QCOMPARE(result.error, Syndication::XmlNotAccepted);
+
+    // rejected before building a DOM
+    result = Syndication::parseDocument(DocumentSource(QByteArray("<!doctype html><html><body>"), QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(!result.feed);
+    QCOMPARE(result.error, Syndication::InvalidXml);
+
+    result = Syndication::parseDocument(DocumentSource(QByteArray("<html lang=en><body>"), QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(!result.feed);
+    QCOMPARE(result.error, Syndication::InvalidXml);
+
+    result = Syndication::parseDocument(DocumentSource(QByteArray(" \n"), QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(!result.feed);
+    QCOMPARE(result.error, Syndication::InvalidXml);
+
+    const QByteArray xhtml(
+        "<?xml version=\"1.0\"?>\n<!-- comment -->\n"
+        "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.0 Strict//EN\" \"http://www.w3.org/TR/xhtml1/DTD/xhtml1-strict.dtd\">\n"
+        "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head/></html>");
+    result = Syndication::parseDocument(DocumentSource(xhtml, QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(!result.feed);
+    QCOMPARE(result.error, Syndication::XmlNotAccepted);
+
+    // HTML5 pages are rejected without building a DOM, whether they happen to be well-formed or not
+    InstrumentationCounters counters;
+    Syndication::setInstrumentation(&counters);
+    const QByteArray html5(
+        "<!DOCTYPE html>\n<html lang=\"en\"><head><title>Blog</title>"
+        "<link rel=\"alternate\" type=\"application/rss+xml\" href=\"/feed.xml\"/></head>"
+        "<body><p>Hello</p></body></html>");
+    result = Syndication::parseDocument(DocumentSource(html5, QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(!result.feed);
+    QCOMPARE(result.error, Syndication::XmlNotAccepted);
+    const QByteArray html5Void(
+        "<!DOCTYPE html>\n<html lang=\"en\"><head><meta charset=\"utf-8\"><title>Blog</title></head>"
+        "<body><p>Hello<br>World</p></body></html>");
+    result = Syndication::parseDocument(DocumentSource(html5Void, QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(!result.feed);
+    QCOMPARE(result.error, Syndication::InvalidXml);
+    Syndication::setInstrumentation(nullptr);
+    QCOMPARE(counters.counters(Instrumentation::BuildDom).count, qint64(0));
+
+    QFile f(QStringLiteral(SYNDICATION_DATA_DIR "/rss2/akregator_blog_rss2.xml"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    result = Syndication::parseDocument(DocumentSource(f.readAll(), QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(result.feed);
+    QCOMPARE(result.error, Syndication::Success);
+}
+
+void SyndicationTest::testRdfSequenceOrder()
+{
+    const QByteArray data(
+        "<?xml version=\"1.0\"?>\n"
+        "<rdf:RDF xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\" xmlns=\"http://purl.org/rss/1.0/\">\n"
+        "<channel rdf:about=\"http://example.com/\"><title>Channel</title><link>http://example.com/</link>\n"
+        "<items><rdf:Seq>\n"
+        "<rdf:li rdf:resource=\"http://example.com/b\"/>\n"
+        "<rdf:li rdf:resource=\"http://example.com/a\"/>\n"
+        "<rdf:li rdf:resource=\"http://example.com/b\"/>\n"
+        "<rdf:li rdf:resource=\"http://example.com/c\"/>\n"
+        "</rdf:Seq></items></channel>\n"
+        "<item rdf:about=\"http://example.com/a\"><title>a</title><link>http://example.com/a</link></item>\n"
+        "<item rdf:about=\"http://example.com/b\"><title>b</title><link>http://example.com/b</link></item>\n"
+        "<item rdf:about=\"http://example.com/c\"><title>c</title><link>http://example.com/c</link></item>\n"
+        "</rdf:RDF>\n");
+
+    FeedPtr feed(Syndication::parse(DocumentSource(data, QStringLiteral("http://libsyndicationtest"))));
+    QVERIFY(feed);
+
+    // an item listed twice is sorted by its first position
+    QStringList titles;
+    const QList<ItemPtr> items = feed->items();
+    for (const ItemPtr &item : items) {
+        titles.append(item->title());
+    }
+    QCOMPARE(titles, (QStringList{QStringLiteral("b"), QStringLiteral("a"), QStringLiteral("c")}));
+}
+
+void SyndicationTest::testConcurrentParse()
+{
+    QList<QByteArray> sources;
+    const QStringList subDirs = {QStringLiteral("atom"), QStringLiteral("rdf"), QStringLiteral("rss2")};
+    for (const QString &subDir : subDirs) {
+        QDir dir(QStringLiteral(SYNDICATION_DATA_DIR "/") + subDir);
+        const auto l = dir.entryList(QStringList(QStringLiteral("*.xml")), QDir::Files | QDir::Readable | QDir::NoSymLinks);
+        for (const QString &file : l) {
+            QFile f(dir.path() + QLatin1Char('/') + file);
+            QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+            sources.append(f.readAll());
+        }
+    }
+    QVERIFY(!sources.isEmpty());
+
+    QStringList expected;
+    for (const QByteArray &source : std::as_const(sources)) {
+        const ParseResult result = Syndication::parseDocument(DocumentSource(source, QStringLiteral("http://libsyndicationtest")));
+        expected.append(result.feed ? result.feed->debugInfo() : QString());
+    }
+
+    // all threads parse the same sources, sharing the DocumentSource objects
+    QList<DocumentSource> documents;
+    for (const QByteArray &source : std::as_const(sources)) {
+        documents.append(DocumentSource(source, QStringLiteral("http://libsyndicationtest")));
+    }
+
+    const int threadCount = 4;
+    QList<QStringList> results(threadCount);
+    QList<QList<ErrorCode>> errors(threadCount);
+    QList<QThread *> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.append(QThread::create([&documents, &results, &errors, t]() {
+            for (const DocumentSource &src : documents) {
+                const ParseResult result = Syndication::parseDocument(src);
+                results[t].append(result.feed ? result.feed->debugInfo() : QString());
+                errors[t].append(result.error);
+            }
+        }));
+    }
+    for (QThread *thread : std::as_const(threads)) {
+        thread->start();
+    }
+    for (QThread *thread : std::as_const(threads)) {
+        QVERIFY(thread->wait());
+        delete thread;
+    }
+
+    for (int t = 0; t < threadCount; ++t) {
+        QCOMPARE(results[t], expected);
+        for (ErrorCode error : std::as_const(errors[t])) {
+            QCOMPARE(error, Syndication::Success);
+        }
+    }
+}
+
+void SyndicationTest::testParseBatch()
+{
+    QList<DocumentSource> sources;
+    const QStringList subDirs = {QStringLiteral("atom"), QStringLiteral("rdf"), QStringLiteral("rss2")};
+    for (const QString &subDir : subDirs) {
+        QDir dir(QStringLiteral(SYNDICATION_DATA_DIR "/") + subDir);
+        const auto l = dir.entryList(QStringList(QStringLiteral("*.xml")), QDir::Files | QDir::Readable | QDir::NoSymLinks);
+        for (const QString &file : l) {
+            QFile f(dir.path() + QLatin1Char('/') + file);
+            QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+            sources.append(DocumentSource(f.readAll(), QStringLiteral("http://libsyndicationtest")));
+        }
+    }
+    sources.append(DocumentSource(QByteArray("this is not xml <"), QStringLiteral("http://libsyndicationtest")));
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+    const BatchParseResult batch = Syndication::parseBatch(sources, QString(), &pool);
+    QCOMPARE(batch.results.size(), sources.size());
+
+    int documents = 0;
+    for (const FormatTiming &timing : batch.timings) {
+        documents += timing.documents;
+    }
+    QCOMPARE(documents, sources.size());
+    QVERIFY(batch.timings.contains(QStringLiteral("atom")));
+    QVERIFY(batch.timings.contains(QStringLiteral("rdf")));
+    QVERIFY(batch.timings.contains(QStringLiteral("rss2")));
+    QCOMPARE(batch.timings.value(QString()).documents, 1);
+
+    for (int i = 0; i < sources.size(); ++i) {
+        const ParseResult expected = Syndication::parseDocument(sources.at(i));
+        const ParseResult &result = batch.results.at(i);
+        QCOMPARE(result.error, expected.error);
+        QCOMPARE(result.format, expected.format);
+        QCOMPARE(bool(result.feed), bool(expected.feed));
+        if (expected.feed) {
+            QCOMPARE(result.feed->debugInfo(), expected.feed->debugInfo());
+        }
+    }
+    QCOMPARE(batch.results.last().error, Syndication::InvalidXml);
+
+    // the caller parses on its own if the pool has no thread to spare
+    pool.setMaxThreadCount(1);
+    QCOMPARE(Syndication::parseBatch(sources, QString(), &pool).results.size(), sources.size());
+}
+
+void SyndicationTest::testContainsMarkup_data()
+{
+    QTest::addColumn<QString>("str");
+    QTest::addColumn<bool>("markup");
+
+    QTest::newRow("empty") << QString() << false;
+    QTest::newRow("plain") << QStringLiteral("Tom & Jerry") << false;
+    QTest::newRow("entity") << QStringLiteral("Tom &amp; Jerry") << true;
+    QTest::newRow("numeric entity") << QStringLiteral("Tom &#38; Jerry") << true;
+    QTest::newRow("empty entity") << QStringLiteral("Tom &; Jerry") << false;
+    QTest::newRow("tag") << QStringLiteral("<b>bold</b>") << true;
+    QTest::newRow("empty element") << QStringLiteral("line<br/>break") << true;
+    QTest::newRow("comparison") << QStringLiteral("a < b and c > d") << false;
+    QTest::newRow("tag across lines") << QStringLiteral("<b\n>") << false;
+    QTest::newRow("unclosed tag") << QStringLiteral("<b") << false;
+    QTest::newRow("non-ASCII tag") << QStringLiteral("<\u00fc>") << false;
+    QTest::newRow("non-ASCII attribute") << QStringLiteral("<b \u00fc>") << true;
+}
+
+void SyndicationTest::testContainsMarkup()
+{
+    QFETCH(QString, str);
+    QFETCH(bool, markup);
+
+    QCOMPARE(Syndication::stringContainsMarkup(str), markup);
+    QCOMPARE(Syndication::isHtml(str), markup);
+}
+
+void SyndicationTest::testNormalize_data()
+{
+    QTest::addColumn<QString>("str");
+    QTest::addColumn<bool>("isCDATA");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("plain") << QStringLiteral(" Tom & Jerry ") << false << QStringLiteral("Tom &amp; Jerry");
+    QTest::newRow("special characters") << QStringLiteral("<\"'>") << false << QStringLiteral("&lt;&quot;&apos;&gt;");
+    QTest::newRow("non-ASCII tag") << QStringLiteral("<\u00fc>") << false << QStringLiteral("&lt;\u00fc&gt;");
+    QTest::newRow("entities kept") << QStringLiteral("a &lt; b") << false << QStringLiteral("a &amp;lt; b");
+    QTest::newRow("cdata entities") << QStringLiteral("a &lt; b &amp;amp;") << true << QStringLiteral("a &lt; b &amp;amp;");
+    QTest::newRow("cdata newlines") << QStringLiteral("\nline\nbreak\n") << true << QStringLiteral("line<br/>break");
+    QTest::newRow("cdata trailing space entity") << QStringLiteral("text&#32;") << true << QStringLiteral("text");
+    QTest::newRow("cdata unknown entity") << QStringLiteral("&foo; & bar;") << true << QStringLiteral("&amp;foo; &amp; bar;");
+}
+
+void SyndicationTest::testNormalize()
+{
+    QFETCH(QString, str);
+    QFETCH(bool, isCDATA);
+    QFETCH(QString, expected);
+
+    QCOMPARE(Syndication::normalize(str, isCDATA, false), expected);
+    QCOMPARE(Syndication::normalize(str, isCDATA, true), str.trimmed());
+    if (!isCDATA) {
+        QCOMPARE(Syndication::escapeSpecialCharacters(str), expected);
+    }
+    QCOMPARE(Syndication::plainTextToHtml(QStringLiteral(" \na <b> & 'c'\n ")), QStringLiteral("<br/>a &lt;b> &amp; 'c'<br/>"));
+}
+
+namespace
+{
+// answers with a fixed document, or reports it as unchanged when asked with its validators
+class ConditionalTestRetriever : public Syndication::ConditionalDataRetriever
+{
+public:
+    explicit ConditionalTestRetriever(const QByteArray &data)
+        : m_data(data)
+    {
+    }
+
+    void retrieveData(const QUrl &url) override
+    {
+        retrieveData(url, Syndication::FeedValidators());
+    }
+
+    void retrieveData(const QUrl &url, const Syndication::FeedValidators &validators) override
+    {
+        Q_UNUSED(url)
+        QTimer::singleShot(0, this, [this, validators]() {
+            if (validators.entityTag == QLatin1String("\"v1\"")) {
+                Q_EMIT notModified();
+                return;
+            }
+            Q_EMIT validatorsReceived({QStringLiteral("\"v1\""), QStringLiteral("Sat, 07 Sep 2002 00:00:01 GMT")});
+            Q_EMIT dataRetrieved(m_data, true);
+        });
+    }
+
+    int errorCode() const override
+    {
+        return 0;
+    }
+
+    void abort() override
+    {
+    }
+
+private:
+    const QByteArray m_data;
+};
+
+// answers with a fixed document, emitted in chunks of the given size first,
+// or all at once if the size is 0
+class ChunkedTestRetriever : public Syndication::DataRetriever
+{
+public:
+    ChunkedTestRetriever(const QByteArray &data, int chunkSize)
+        : m_data(data)
+        , m_chunkSize(chunkSize)
+    {
+    }
+
+    void retrieveData(const QUrl &url) override
+    {
+        Q_UNUSED(url)
+        QTimer::singleShot(0, this, [this]() {
+            for (qsizetype pos = 0; m_chunkSize > 0 && pos < m_data.size(); pos += m_chunkSize) {
+                Q_EMIT dataReceived(m_data.mid(pos, m_chunkSize));
+            }
+            Q_EMIT dataRetrieved(m_data, true);
+        });
+    }
+
+    int errorCode() const override
+    {
+        return 0;
+    }
+
+    void abort() override
+    {
+    }
+
+private:
+    const QByteArray m_data;
+    const int m_chunkSize;
+};
+
+class RSS2DocumentVisitor : public Syndication::DocumentVisitor
+{
+public:
+    bool visitRSS2Document(Syndication::RSS2::Document *document) override
+    {
+        Q_UNUSED(document)
+        return true;
+    }
+};
+}
+
+void SyndicationTest::testLoaderNotModified()
+{
+    QFile f(QStringLiteral(SYNDICATION_DATA_DIR "/rss2/akregator_blog_rss2.xml"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QByteArray data = f.readAll();
+    const QUrl url(QStringLiteral("http://libsyndicationtest"));
+
+    bool done = false;
+    Syndication::ErrorCode error = Syndication::Aborted;
+    bool hasFeed = false;
+    Syndication::FeedValidators validators;
+    const auto load = [&](const Syndication::FeedValidators &previous) {
+        done = false;
+        Syndication::Loader *loader = Syndication::Loader::create();
+        connect(loader, &Syndication::Loader::loadingComplete, this, [&](Syndication::Loader *l, const Syndication::FeedPtr &feed, Syndication::ErrorCode e) {
+            error = e;
+            hasFeed = !feed.isNull();
+            validators = l->validators();
+            done = true;
+        });
+        loader->loadFrom(url, new ConditionalTestRetriever(data), previous);
+    };
+
+    load(Syndication::FeedValidators());
+    QTRY_VERIFY(done);
+    QCOMPARE(error, Syndication::Success);
+    QVERIFY(hasFeed);
+    QCOMPARE(validators.entityTag, QStringLiteral("\"v1\""));
+
+    load(validators);
+    QTRY_VERIFY(done);
+    QCOMPARE(error, Syndication::NotModified);
+    QVERIFY(!hasFeed);
+    QCOMPARE(validators.entityTag, QStringLiteral("\"v1\""));
+    QCOMPARE(validators.lastModified, QStringLiteral("Sat, 07 Sep 2002 00:00:01 GMT"));
+}
+
+void SyndicationTest::testLoaderIncremental()
+{
+    QFile f(QStringLiteral(SYNDICATION_DATA_DIR "/rss2/akregator_blog_rss2.xml"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QByteArray data = f.readAll();
+    const QUrl url(QStringLiteral("http://libsyndicationtest"));
+
+    bool done = false;
+    Syndication::ErrorCode error = Syndication::Aborted;
+    FeedPtr feed;
+    Syndication::Loader *loader = Syndication::Loader::create();
+    connect(loader, &Syndication::Loader::loadingComplete, this, [&](Syndication::Loader *, const Syndication::FeedPtr &result, Syndication::ErrorCode e) {
+        error = e;
+        feed = result;
+        done = true;
+    });
+    loader->loadFrom(url, new ChunkedTestRetriever(data, 100));
+    QTRY_VERIFY(done);
+    QCOMPARE(error, Syndication::Success);
+    QVERIFY(feed);
+
+    // read by the streaming parser, with the same result as the DOM parser
+    FeedPtr complete(Syndication::parse(DocumentSource(data, url.url())));
+    QVERIFY(complete);
+    RSS2DocumentVisitor visitor;
+    QVERIFY(visitor.visit(complete->specificDocument().data()));
+    QVERIFY(!visitor.visit(feed->specificDocument().data()));
+    QCOMPARE(feed->debugInfo().split(QLatin1Char('\n')), complete->debugInfo().split(QLatin1Char('\n')));
+}
+
+void SyndicationTest::testLoaderDiscovery()
+{
+    const QUrl url(QStringLiteral("http://example.com/blog/"));
+
+    bool done = false;
+    Syndication::ErrorCode error = Syndication::Success;
+    bool hasFeed = false;
+    QList<FeedCandidate> candidates;
+    QUrl discoveredUrl;
+    const auto load = [&](const QByteArray &data) {
+        done = false;
+        Syndication::Loader *loader = Syndication::Loader::create();
+        connect(loader, &Syndication::Loader::loadingComplete, this, [&](Syndication::Loader *l, const Syndication::FeedPtr &feed, Syndication::ErrorCode e) {
+            error = e;
+            hasFeed = !feed.isNull();
+            candidates = l->discoveredFeeds();
+            discoveredUrl = l->discoveredFeedURL();
+            done = true;
+        });
+        loader->loadFrom(url, new ChunkedTestRetriever(data, 0));
+    };
+
+    load(QByteArray("<html><head><title>Blog</title>\n"
+                    "<link rel=\"alternate\" type=\"application/atom+xml\" href=\"/atom.xml\" title=\"Atom\">\n"
+                    "<link rel=\"alternate\" type=\"application/rss+xml\" href=\"rss.xml\" title=\"RSS\">\n"
+                    "</head><body><a href=\"/feed.rdf\">RDF</a></body></html>"));
+    QTRY_VERIFY(done);
+    QVERIFY(error != Syndication::Success);
+    QVERIFY(!hasFeed);
+    // <a> links are only looked at if there are no alternate links
+    QCOMPARE(candidates.size(), 2);
+    QCOMPARE(candidates.at(0).url, QUrl(QStringLiteral("http://example.com/blog/rss.xml")));
+    QCOMPARE(candidates.at(0).type, QStringLiteral("application/rss+xml"));
+    QCOMPARE(candidates.at(0).title, QStringLiteral("RSS"));
+    QCOMPARE(candidates.at(1).url, QUrl(QStringLiteral("http://example.com/atom.xml")));
+    QCOMPARE(discoveredUrl, candidates.at(0).url);
+
+    load(QByteArray("<html><head><title>Blog</title></head><body><a href=\"/feed.rdf\">RDF</a></body></html>"));
+    QTRY_VERIFY(done);
+    QVERIFY(error != Syndication::Success);
+    QCOMPARE(candidates.size(), 1);
+    QCOMPARE(candidates.at(0).url, QUrl(QStringLiteral("http://example.com/feed.rdf")));
+    QVERIFY(candidates.at(0).type.isEmpty());
+    QCOMPARE(discoveredUrl, candidates.at(0).url);
+
+    load(QByteArray("<html><head><title>No feeds</title></head><body><p>nothing</p></body></html>"));
+    QTRY_VERIFY(done);
+    QVERIFY(error != Syndication::Success);
+    QVERIFY(!hasFeed);
+    QVERIFY(candidates.isEmpty());
+    QVERIFY(discoveredUrl.isEmpty());
+}
+
+void SyndicationTest::testDigest()
+{
+    // XXH64 reference values
+    QCOMPARE(DocumentSource(QByteArray(), QString()).digest(), Q_UINT64_C(0xef46db3751d8e999));
+    QCOMPARE(DocumentSource(QByteArray("abc"), QString()).digest(), Q_UINT64_C(0x44bc2cf5ad770999));
+    QCOMPARE(DocumentSource(QByteArray("Nobody inspects the spammish repetition"), QString()).digest(), Q_UINT64_C(0xfbcea83c8a378bf1));
+
+    // bytes after a NUL count as well
+    const DocumentSource a(QByteArray("a\0b", 3), QString());
+    const DocumentSource b(QByteArray("a\0c", 3), QString());
+    QVERIFY(a.digest() != b.digest());
+    QVERIFY(a.hash() != b.hash());
+}
+
+void SyndicationTest::testParseCache()
+{
+    QFile f(QStringLiteral(SYNDICATION_DATA_DIR "/rss2/akregator_blog_rss2.xml"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QByteArray data = f.readAll();
+
+    QCOMPARE(Syndication::parseCacheCapacity(), 0);
+    ParseResult first = Syndication::parseDocument(DocumentSource(data, QString()));
+    ParseResult second = Syndication::parseDocument(DocumentSource(data, QString()));
+    QVERIFY(first.feed);
+    QVERIFY(first.feed != second.feed);
+
+    Syndication::setParseCacheCapacity(2);
+    QCOMPARE(Syndication::parseCacheCapacity(), 2);
+    first = Syndication::parseDocument(DocumentSource(data, QStringLiteral("http://libsyndicationtest")));
+    second = Syndication::parseDocument(DocumentSource(data, QString()));
+    QVERIFY(first.feed);
+    QCOMPARE(second.feed, first.feed);
+    QCOMPARE(second.format, first.format);
+
+    // a different format hint is a different result
+    QVERIFY(Syndication::parseDocument(DocumentSource(data, QString()), QStringLiteral("rss2stream")).feed != first.feed);
+
+    const ParseResult invalid = Syndication::parseDocument(DocumentSource(QByteArray("not xml"), QString()));
+    QCOMPARE(invalid.error, Syndication::InvalidXml);
+    QCOMPARE(Syndication::parseDocument(DocumentSource(QByteArray("not xml"), QString())).error, Syndication::InvalidXml);
+
+    Syndication::setParseCacheCapacity(0);
+    QVERIFY(Syndication::parseDocument(DocumentSource(data, QString())).feed != first.feed);
+}
+
+void SyndicationTest::testFeedDiff()
+{
+    const auto rss = [](const QByteArray &items) {
+        return DocumentSource(QByteArray("<rss version=\"2.0\"><channel><title>Test</title><link>http://example.com/</link>") + items
+                                  + QByteArray("</channel></rss>"),
+                              QString());
+    };
+    const QByteArray first("<item><guid>1</guid><title>One</title></item>"
+                           "<item><guid>2</guid><title>Two</title><description>old</description></item>"
+                           "<item><title>Three</title><category domain=\"a\" xmlns:x=\"urn:x\" x:y=\"z\">c</category></item>"
+                           "<item><link>five</link><title>Five</title></item>"
+                           "<item><title>Six &amp; Seven</title></item>");
+    const QByteArray second("<item>\n  <title>One</title>\n  <guid>1</guid>\n</item>"
+                            "<item><guid>2</guid><title>Two</title><description>new</description></item>"
+                            "<item><title>Three</title><category x:y=\"z\" xmlns:x=\"urn:x\" domain=\"a\">c</category></item>"
+                            "<item><guid>4</guid><title>Four</title></item>"
+                            "<item><link>five</link><title>Five</title></item>"
+                            "<item><title>Six &amp; Seven</title></item>");
+
+    const QStringList formats = {QStringLiteral("rss2"), QStringLiteral("rss2stream")};
+    QList<ItemFingerprint> fingerprints[2];
+    for (int i = 0; i < formats.size(); ++i) {
+        const FeedPtr firstFeed = Syndication::parse(rss(first), formats.at(i));
+        QVERIFY(firstFeed);
+        const FeedDiff initial = diffFeed(firstFeed, QList<ItemFingerprint>());
+        QCOMPARE(initial.newItems.size(), 5);
+        QVERIFY(initial.changedItems.isEmpty());
+        QCOMPARE(initial.fingerprints.size(), 5);
+        QCOMPARE(diffFeed(firstFeed, initial.fingerprints).newItems.size(), 0);
+        fingerprints[i] = initial.fingerprints;
+        // the diff reads the format-specific items, with the same result as itemFingerprint()
+        const QList<ItemPtr> firstItems = firstFeed->items();
+        for (int j = 0; j < firstItems.size(); ++j) {
+            QCOMPARE(initial.fingerprints.at(j), itemFingerprint(firstItems.at(j)));
+            QCOMPARE(initial.newItems.at(j)->title(), firstItems.at(j)->title());
+        }
+
+        const FeedPtr secondFeed = Syndication::parse(rss(second), formats.at(i));
+        QVERIFY(secondFeed);
+        const FeedDiff diff = diffFeed(secondFeed, initial.fingerprints);
+        QCOMPARE(diff.newItems.size(), 1);
+        QCOMPARE(diff.newItems.first()->title(), QStringLiteral("Four"));
+        // reordered children change the content, reordered attributes do not
+        QCOMPARE(diff.changedItems.size(), 2);
+        QCOMPARE(diff.changedItems.at(0)->title(), QStringLiteral("One"));
+        QCOMPARE(diff.changedItems.at(1)->title(), QStringLiteral("Two"));
+        QCOMPARE(diff.fingerprints.size(), 6);
+    }
+    // the streaming parser reads the same content as the DOM parser, and
+    // identifies items without guid by the relative link and raw title
+    for (int i = 0; i < fingerprints[0].size(); ++i) {
+        QCOMPARE(fingerprints[1].at(i).content, fingerprints[0].at(i).content);
+        QCOMPARE(fingerprints[1].at(i).identity, fingerprints[0].at(i).identity);
+    }
+
+    QFile f(QStringLiteral(SYNDICATION_DATA_DIR "/atom/atom10_entry_id.xml"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    const FeedPtr atom = Syndication::parse(DocumentSource(f.readAll(), QString()));
+    QVERIFY(atom);
+    const FeedDiff atomDiff = diffFeed(atom, QList<ItemFingerprint>());
+    QCOMPARE(atomDiff.newItems.size(), atom->items().size());
+    QCOMPARE(atomDiff.fingerprints.first(), itemFingerprint(atom->items().first()));
+    QVERIFY(diffFeed(atom, atomDiff.fingerprints).newItems.isEmpty());
+
+    QFile rdfFile(QStringLiteral(SYNDICATION_DATA_DIR "/rdf/heise.de-newsticker.xml"));
+    QVERIFY(rdfFile.open(QIODevice::ReadOnly | QIODevice::Text));
+    const FeedPtr rdf = Syndication::parse(DocumentSource(rdfFile.readAll(), QString()));
+    QVERIFY(rdf);
+    const QList<ItemPtr> rdfItems = rdf->items();
+    const FeedDiff rdfDiff = diffFeed(rdf, QList<ItemFingerprint>());
+    QCOMPARE(rdfDiff.newItems.size(), rdfItems.size());
+    for (int i = 0; i < rdfItems.size(); ++i) {
+        QCOMPARE(rdfDiff.fingerprints.at(i), itemFingerprint(rdfItems.at(i)));
+        QCOMPARE(rdfDiff.newItems.at(i)->link(), rdfItems.at(i)->link());
+    }
+    QVERIFY(diffFeed(rdf, rdfDiff.fingerprints).newItems.isEmpty());
+
+    QVERIFY(diffFeed(FeedPtr(), atomDiff.fingerprints).fingerprints.isEmpty());
+}
+
+void SyndicationTest::testInstrumentation()
+{
+    QFile f(QStringLiteral(SYNDICATION_DATA_DIR "/rss2/akregator_blog_rss2.xml"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QByteArray data = f.readAll();
+
+    QVERIFY(!Syndication::instrumentation());
+    InstrumentationCounters counters;
+    Syndication::setInstrumentation(&counters);
+    QVERIFY(Syndication::instrumentation() == &counters);
+
+    const ParseResult result = Syndication::parseDocument(DocumentSource(data, QString()));
+    QVERIFY(result.feed);
+    const QString format = QStringLiteral("rss2");
+
+    const StageCounters accept = counters.counters(Instrumentation::Accept, format);
+    QCOMPARE(accept.count, qint64(1));
+    QCOMPARE(accept.bytes, qint64(data.size()));
+    QCOMPARE(counters.counters(Instrumentation::Parse, format).count, qint64(1));
+    QCOMPARE(counters.counters(Instrumentation::BuildDom).count, qint64(1));
+    QCOMPARE(counters.counters(Instrumentation::Parse, QStringLiteral("atom")).count, qint64(0));
+
+    const StageCounters map = counters.counters(Instrumentation::Map, format);
+    QCOMPARE(map.count, qint64(1));
+    QCOMPARE(map.items, qint64(result.feed->items().size()));
+    QVERIFY(map.nsecs >= 0);
+    QCOMPARE(counters.counters(Instrumentation::Map).items, map.items);
+
+    // streamed documents are reported when the incremental parser finishes
+    IncrementalParser parser;
+    for (qsizetype pos = 0; pos < data.size(); pos += 100) {
+        parser.addData(data.mid(pos, 100));
+    }
+    QVERIFY(parser.finish());
+    const QString streamFormat = QStringLiteral("rss2stream");
+    QCOMPARE(counters.counters(Instrumentation::Accept, streamFormat).count, qint64(1));
+    QCOMPARE(counters.counters(Instrumentation::Parse, streamFormat).count, qint64(1));
+    QCOMPARE(counters.counters(Instrumentation::Parse, streamFormat).bytes, qint64(data.size()));
+    QCOMPARE(counters.counters(Instrumentation::Map, streamFormat).items, map.items);
+    QCOMPARE(counters.counters(Instrumentation::BuildDom).count, qint64(1));
+
+    // nothing is reported without instrumentation
+    Syndication::setInstrumentation(nullptr);
+    QVERIFY(Syndication::parseDocument(DocumentSource(data, QString())).feed);
+    QCOMPARE(counters.counters(Instrumentation::Parse, format).count, qint64(1));
+
+    counters.reset();
+    QCOMPARE(counters.counters(Instrumentation::Parse, format).count, qint64(0));
+}
+
+void SyndicationTest::testFeedSnapshot_data()
+{
+    QTest::addColumn<QString>("fileName");
+
+    QTest::newRow("rss2") << QStringLiteral(SYNDICATION_DATA_DIR "/rss2/akregator_blog_rss2.xml");
+    QTest::newRow("atom") << QStringLiteral(SYNDICATION_DATA_DIR "/atom/atom10_entry_id.xml");
+    QTest::newRow("rdf") << QStringLiteral(SYNDICATION_DATA_DIR "/rdf/heise.de-newsticker.xml");
+}
+
+void SyndicationTest::testFeedSnapshot()
+{
+    QFETCH(QString, fileName);
+
+    QFile f(fileName);
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+
+    FeedPtr feed = Syndication::parse(DocumentSource(f.readAll(), QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(feed);
+    const QString debugInfo = feed->debugInfo();
+    const int itemCount = feed->items().size();
+
+    const FeedSnapshot snapshot(feed);
+    QVERIFY(!snapshot.isNull());
+    QCOMPARE(snapshot.itemCount(), itemCount);
+    QVERIFY(snapshot.size() > 0);
+
+    // the snapshot does not depend on the parsed feed and its DOM
+    feed.clear();
+    const FeedSnapshot copy = snapshot;
+    const FeedPtr snapshotFeed = copy.feed();
+    QVERIFY(snapshotFeed);
+    QVERIFY(!snapshotFeed->specificDocument());
+    QCOMPARE(snapshotFeed->debugInfo(), debugInfo);
+    QCOMPARE(snapshotFeed->items().size(), itemCount);
+
+    QVERIFY(FeedSnapshot().isNull());
+    QVERIFY(FeedSnapshot(FeedPtr()).isNull());
+    QVERIFY(!FeedSnapshot().feed());
+}
+
+void SyndicationTest::testFeedSnapshotProperties()
+{
+    const QByteArray data(
+        "<rss version=\"2.0\" xmlns:x=\"urn:x\"><channel><title>Test</title><link>http://example.com/</link><description/>"
+        "<x:channel>c</x:channel>"
+        "<item><title>One</title><x:value n=\"1\">first</x:value><x:value n=\"2\">second</x:value></item>"
+        "<item><title>One</title></item>"
+        "</channel></rss>");
+
+    for (const QString &format : {QStringLiteral("rss2"), QStringLiteral("rss2stream")}) {
+        const FeedPtr feed = Syndication::parse(DocumentSource(data, QString()), format);
+        QVERIFY(feed);
+        const FeedPtr snapshotFeed = FeedSnapshot(feed).feed();
+        QVERIFY(snapshotFeed);
+
+        // empty and null strings stay apart
+        QCOMPARE(snapshotFeed->description().isNull(), feed->description().isNull());
+        QCOMPARE(snapshotFeed->description(), feed->description());
+        QVERIFY(snapshotFeed->copyright().isNull());
+
+        const QMultiMap<QString, QDomElement> channel = snapshotFeed->additionalProperties();
+        QCOMPARE(channel.size(), feed->additionalProperties().size());
+        QCOMPARE(channel.value(QStringLiteral("urn:xchannel")).text(), QStringLiteral("c"));
+
+        const QList<ItemPtr> items = snapshotFeed->items();
+        QCOMPARE(items.size(), 2);
+        QCOMPARE(items.at(0)->title(), items.at(1)->title());
+        QVERIFY(!items.at(0)->specificItem());
+
+        // values with the same key keep their order
+        const QList<QDomElement> original = feed->items().first()->additionalProperties().values(QStringLiteral("urn:xvalue"));
+        const QList<QDomElement> values = items.first()->additionalProperties().values(QStringLiteral("urn:xvalue"));
+        QCOMPARE(values.size(), 2);
+        for (int i = 0; i < values.size(); ++i) {
+            QCOMPARE(values.at(i).text(), original.at(i).text());
+            QCOMPARE(values.at(i).attribute(QStringLiteral("n")), original.at(i).attribute(QStringLiteral("n")));
+            QCOMPARE(values.at(i).namespaceURI(), QStringLiteral("urn:x"));
+        }
+        QVERIFY(items.at(1)->additionalProperties().isEmpty());
+    }
+}
+
+void SyndicationTest::testFeedSnapshotFile()
+{
+    QFile f(QStringLiteral(SYNDICATION_DATA_DIR "/rss2/akregator_blog_rss2.xml"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QByteArray data = f.readAll().replace("</channel>", "<x:extra xmlns:x=\"urn:x\" a=\"b\">text</x:extra></channel>");
+
+    const FeedPtr feed = Syndication::parse(DocumentSource(data, QStringLiteral("http://libsyndicationtest")));
+    QVERIFY(feed);
+    const FeedSnapshot snapshot(feed);
+    const QByteArray binary = snapshot.toByteArray();
+    QVERIFY(!binary.isEmpty());
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("feed.snapshot"));
+    QVERIFY(snapshot.save(fileName));
+
+    // copies at an odd address have to be realigned
+    const QByteArray shifted = QByteArray(1, ' ') + binary;
+    const QByteArray unaligned = QByteArray::fromRawData(shifted.constData() + 1, binary.size());
+
+    const QList<FeedSnapshot> loaded = {FeedSnapshot::fromByteArray(binary), FeedSnapshot::fromByteArray(unaligned), FeedSnapshot::load(fileName)};
+    for (const FeedSnapshot &copy : loaded) {
+        QVERIFY(!copy.isNull());
+        QCOMPARE(copy.itemCount(), snapshot.itemCount());
+        QCOMPARE(copy.toByteArray(), binary);
+
+        const FeedPtr copyFeed = copy.feed();
+        QCOMPARE(copyFeed->debugInfo(), feed->debugInfo());
+        const QDomElement extra = copyFeed->additionalProperties().value(QStringLiteral("urn:xextra"));
+        QCOMPARE(extra.text(), QStringLiteral("text"));
+        QCOMPARE(extra.attribute(QStringLiteral("a")), QStringLiteral("b"));
+    }
+
+    // anything else is rejected
+    QVERIFY(FeedSnapshot::fromByteArray(QByteArray()).isNull());
+    QVERIFY(FeedSnapshot::fromByteArray(data).isNull());
+    QVERIFY(FeedSnapshot::fromByteArray(binary.left(binary.size() / 2)).isNull());
+    QByteArray otherVersion = binary;
+    otherVersion[8] = char(otherVersion[8] + 1);
+    QVERIFY(FeedSnapshot::fromByteArray(otherVersion).isNull());
+    QVERIFY(FeedSnapshot::load(dir.filePath(QStringLiteral("missing"))).isNull());
+    QVERIFY(!FeedSnapshot().save(dir.filePath(QStringLiteral("null"))));
+    QVERIFY(FeedSnapshot().toByteArray().isEmpty());
+}
+
 #include "moc_syndicationtest.cpp"
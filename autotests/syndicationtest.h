@@ -19,6 +19,32 @@ public:
 private Q_SLOTS:
     void testSyncationFile_data();
     void testSyncationFile();
+    void testStreamingRss2_data();
+    void testStreamingRss2();
+    void testStreamingAtom_data();
+    void testStreamingAtom();
+    void testAtomEntryHandler();
+    void testIncrementalParser_data();
+    void testIncrementalParser();
+    void testParseDocumentErrors();
+    void testRdfSequenceOrder();
+    void testConcurrentParse();
+    void testParseBatch();
+    void testContainsMarkup_data();
+    void testContainsMarkup();
+    void testNormalize_data();
+    void testNormalize();
+    void testLoaderNotModified();
+    void testLoaderIncremental();
+    void testLoaderDiscovery();
+    void testDigest();
+    void testParseCache();
+    void testFeedDiff();
+    void testInstrumentation();
+    void testFeedSnapshot_data();
+    void testFeedSnapshot();
+    void testFeedSnapshotProperties();
+    void testFeedSnapshotFile();
 };
 
 #endif // SYNDICATIONTEST_H
@@ -0,0 +1,139 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "testdateparsing.h"
+#include "tools.h"
+
+#include <QDateTime>
+#include <QStringList>
+#include <QTimeZone>
+
+using Syndication::parseDate;
+using Syndication::parseISODate;
+using Syndication::parseRFCDate;
+
+// the QDateTime based parsing the library used before it got its own
+// tokenizer, kept as the baseline for the benchmark
+static uint qtParseDate(const QString &str)
+{
+    QDateTime kdt = QDateTime::fromString(str, Qt::RFC2822Date);
+    if (!kdt.isValid()) {
+        kdt = QDateTime::fromString(QStringView(str).chopped(4), Qt::RFC2822Date);
+    }
+    if (!kdt.isValid()) {
+        kdt = QDateTime::fromString(str, Qt::ISODate);
+    }
+    if (!kdt.isValid()) {
+        return 0;
+    }
+    if (kdt.time() == QTime(0, 0) && kdt.timeSpec() == Qt::LocalTime) {
+        kdt.setTimeZone(QTimeZone::utc());
+        kdt.setTime(QTime(12, 0));
+    }
+    return kdt.toMSecsSinceEpoch() / 1000;
+}
+
+void TestDateParsing::parseRFCDate_data()
+{
+    QTest::addColumn<QString>("str");
+    QTest::addColumn<uint>("expected");
+
+    QTest::newRow("gmt") << QStringLiteral("Sat, 07 Sep 2002 00:00:01 GMT") << 1031356801u;
+    QTest::newRow("ut") << QStringLiteral("Sat, 07 Sep 2002 00:00:01 UT") << 1031356801u;
+    QTest::newRow("no day name") << QStringLiteral("07 Sep 2002 00:00:01 +0000") << 1031356801u;
+    QTest::newRow("single digit day") << QStringLiteral("Sat, 7 Sep 2002 00:00:01 GMT") << 1031356801u;
+    QTest::newRow("no zone") << QStringLiteral("Sat, 07 Sep 2002 00:00:01") << 1031356801u;
+    QTest::newRow("positive offset") << QStringLiteral("Sun, 02 Mar 2008 13:57:40 +0100") << 1204462660u;
+    QTest::newRow("no seconds") << QStringLiteral("Sun, 02 Mar 2008 13:57 +0100") << 1204462620u;
+    QTest::newRow("est") << QStringLiteral("Sat, 07 Sep 2002 00:00:01 EST") << 1031374801u;
+    QTest::newRow("cdt") << QStringLiteral("Sat, 07 Sep 2002 00:00:01 CDT") << 1031374801u;
+    QTest::newRow("pdt") << QStringLiteral("Fri, 31 Dec 1999 23:59:59 PDT") << 946709999u;
+    QTest::newRow("military") << QStringLiteral("Sat, 07 Sep 2002 00:00:01 A") << 1031356801u;
+    QTest::newRow("two digit year") << QStringLiteral("Sat, 07 Sep 02 00:00:01 GMT") << 1031356801u;
+    QTest::newRow("leap day") << QStringLiteral("Thu, 29 Feb 2024 08:00:00 GMT") << 1709193600u;
+    QTest::newRow("invalid day") << QStringLiteral("Fri, 30 Feb 2024 08:00:00 GMT") << 0u;
+    QTest::newRow("garbage") << QStringLiteral("yesterday at noon") << 0u;
+}
+
+void TestDateParsing::parseRFCDate()
+{
+    QFETCH(QString, str);
+    QFETCH(uint, expected);
+
+    QCOMPARE(parseRFCDate(str), expected);
+}
+
+void TestDateParsing::parseISODate_data()
+{
+    QTest::addColumn<QString>("str");
+    QTest::addColumn<uint>("expected");
+
+    QTest::newRow("utc") << QStringLiteral("2003-12-13T18:30:02Z") << 1071340202u;
+    QTest::newRow("fraction") << QStringLiteral("2003-12-13T18:30:02.25Z") << 1071340202u;
+    QTest::newRow("offset") << QStringLiteral("2003-12-13T19:30:02+01:00") << 1071340202u;
+    QTest::newRow("offset without colon") << QStringLiteral("2003-12-13T19:30:02+0100") << 1071340202u;
+    QTest::newRow("negative offset") << QStringLiteral("2003-12-13T13:30:02-05:00") << 1071340202u;
+    QTest::newRow("no seconds") << QStringLiteral("2003-12-13T18:30Z") << 1071340200u;
+    QTest::newRow("date only") << QStringLiteral("2003-12-13") << 1071316800u;
+    QTest::newRow("local midnight") << QStringLiteral("2003-12-13T00:00:00") << 1071316800u;
+    QTest::newRow("invalid month") << QStringLiteral("2003-13-13T18:30:02Z") << 0u;
+    QTest::newRow("garbage") << QStringLiteral("13.12.2003") << 0u;
+}
+
+void TestDateParsing::parseISODate()
+{
+    QFETCH(QString, str);
+    QFETCH(uint, expected);
+
+    QCOMPARE(parseISODate(str), expected);
+}
+
+void TestDateParsing::parseDate()
+{
+    // whatever the hint, the other format is tried as well
+    QCOMPARE(parseDate(QStringLiteral("2003-12-13T18:30:02Z"), Syndication::RFCDate), 1071340202u);
+    QCOMPARE(parseDate(QStringLiteral("Sat, 07 Sep 2002 00:00:01 GMT"), Syndication::ISODate), 1031356801u);
+    QCOMPARE(parseDate(QString()), 0u);
+
+    // local times are left to QDateTime
+    const QString local = QStringLiteral("2003-12-13T18:30:02");
+    QCOMPARE(parseISODate(local), qtParseDate(local));
+}
+
+void TestDateParsing::benchmarkParseDate_data()
+{
+    QTest::addColumn<bool>("qt");
+
+    QTest::newRow("tokenizer") << false;
+    QTest::newRow("QDateTime") << true;
+}
+
+void TestDateParsing::benchmarkParseDate()
+{
+    QFETCH(bool, qt);
+
+    const QStringList dates = {
+        QStringLiteral("Sat, 07 Sep 2002 00:00:01 GMT"),
+        QStringLiteral("Sun, 02 Mar 2008 13:57:40 +0100"),
+        QStringLiteral("Fri, 31 Dec 1999 23:59:59 PDT"),
+        QStringLiteral("2003-12-13T18:30:02Z"),
+        QStringLiteral("2003-12-13T19:30:02.25+01:00"),
+        QStringLiteral("2003-12-13"),
+    };
+
+    uint sum = 0;
+    QBENCHMARK {
+        for (const QString &date : dates) {
+            sum += qt ? qtParseDate(date) : parseDate(date);
+        }
+    }
+    QVERIFY(sum != 0);
+}
+
+QTEST_MAIN(TestDateParsing)
+
+#include "moc_testdateparsing.cpp"
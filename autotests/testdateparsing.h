@@ -0,0 +1,29 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_TESTS_TESTDATEPARSING_H
+#define SYNDICATION_TESTS_TESTDATEPARSING_H
+
+#include <QTest>
+
+class TestDateParsing : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void parseRFCDate_data();
+    void parseRFCDate();
+    void parseISODate_data();
+    void parseISODate();
+    void parseDate();
+
+    void benchmarkParseDate_data();
+    void benchmarkParseDate();
+};
+
+#endif // SYNDICATION_TESTS_TESTDATEPARSING_H
@@ -61,6 +61,13 @@ void TestPersonImpl::fromString()
     s.append(QStringLiteral("<foo@bar.com> (Foo Bar)"));
     p.append(PersonPtr(new PersonImpl(QStringLiteral("Foo Bar"), QString(), QStringLiteral("foo@bar.com"))));
 
+    // only ASCII whitespace separates the address, as with the \s of a regular expression
+    s.append(QStringLiteral("Foo\u00a0foo@bar.com"));
+    p.append(PersonPtr(new PersonImpl(QString(), QString(), QStringLiteral("Foo\u00a0foo@bar.com"))));
+
+    s.append(QStringLiteral("Foo\tfoo@bar.com"));
+    p.append(PersonPtr(new PersonImpl(QStringLiteral("Foo"), QString(), QStringLiteral("foo@bar.com"))));
+
     // s.append("OnAhlmann(mailto:&amp;#111;&amp;#110;&amp;#97;&amp;#104;&amp;#108;&amp;#109;&amp;#97;&amp;#110;&amp;#110;&amp;#64;&amp;#103;&amp;#109;&amp;#97;&amp;#105;&amp;#108;&amp;#46;&amp;#99;&amp;#111;&amp;#109;)");
     // p.append(PersonPtr(new PersonImpl("OnAhlmann", QString(), "onahlmann@gmail.com")));
 
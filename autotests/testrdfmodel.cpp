@@ -0,0 +1,181 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "testrdfmodel.h"
+#include "rdf/literal.h"
+#include "rdf/model.h"
+#include "rdf/property.h"
+#include "rdf/rdfvocab.h"
+#include "rdf/resource.h"
+#include "rdf/statement.h"
+
+#include <QList>
+#include <QString>
+
+using namespace Syndication::RDF;
+
+void TestRDFModel::testResourcesWithType()
+{
+    Model model;
+    const PropertyPtr type = RDFVocab::self()->type();
+    const ResourcePtr item = model.createResource(QStringLiteral("http://example.com/item"));
+    const ResourcePtr channel = model.createResource(QStringLiteral("http://example.com/channel"));
+    const ResourcePtr a = model.createResource(QStringLiteral("http://example.com/a"));
+    const ResourcePtr b = model.createResource(QStringLiteral("http://example.com/b"));
+    const ResourcePtr c = model.createResource(QStringLiteral("http://example.com/c"));
+
+    QVERIFY(model.resourcesWithType(item).isEmpty());
+
+    model.addStatement(a, type, item);
+    model.addStatement(c, type, channel);
+    model.addStatement(b, type, item);
+    // adding a statement twice does not list the subject twice
+    model.addStatement(a, type, item);
+
+    // in the order the statements were added
+    const QList<ResourcePtr> items = model.resourcesWithType(item);
+    QCOMPARE(items.size(), 2);
+    QCOMPARE(items.at(0)->uri(), a->uri());
+    QCOMPARE(items.at(1)->uri(), b->uri());
+
+    const QList<ResourcePtr> channels = model.resourcesWithType(channel);
+    QCOMPARE(channels.size(), 1);
+    QCOMPARE(channels.at(0)->uri(), c->uri());
+
+    // a type from outside the model is looked up by its URI
+    const ResourcePtr external(new Resource(QStringLiteral("http://example.com/item")));
+    QCOMPARE(model.resourcesWithType(external).size(), 2);
+    const ResourcePtr unknown(new Resource(QStringLiteral("http://example.com/unknown")));
+    QVERIFY(model.resourcesWithType(unknown).isEmpty());
+
+    // statements with other predicates do not count as types
+    const PropertyPtr title = model.createProperty(QStringLiteral("http://example.com/title"));
+    model.addStatement(c, title, item);
+    QCOMPARE(model.resourcesWithType(item).size(), 2);
+}
+
+void TestRDFModel::testPropertyLookup()
+{
+    Model model;
+    const ResourcePtr res = model.createResource(QStringLiteral("http://example.com/item"));
+    const ResourcePtr other = model.createResource(QStringLiteral("http://example.com/other"));
+    const PropertyPtr title = model.createProperty(QStringLiteral("http://example.com/title"));
+    const PropertyPtr link = model.createProperty(QStringLiteral("http://example.com/link"));
+    const PropertyPtr subject = model.createProperty(QStringLiteral("http://example.com/subject"));
+
+    QVERIFY(model.isEmpty());
+    QCOMPARE(model.createResource(QStringLiteral("http://example.com/item")), res);
+
+    model.addStatement(res, title, model.createLiteral(QStringLiteral("Title")));
+    model.addStatement(res, link, other);
+    model.addStatement(res, subject, model.createLiteral(QStringLiteral("first")));
+    model.addStatement(res, subject, model.createLiteral(QStringLiteral("second")));
+    QCOMPARE(model.statements().size(), 4);
+
+    QVERIFY(res->hasProperty(title));
+    QCOMPARE(res->property(title)->asString(), QStringLiteral("Title"));
+    QCOMPARE(res->property(link)->asResource()->uri(), other->uri());
+
+    // all statements, in the order they were added
+    const QList<StatementPtr> subjects = res->properties(subject);
+    QCOMPARE(subjects.size(), 2);
+    QCOMPARE(subjects.at(0)->asString(), QStringLiteral("first"));
+    QCOMPARE(subjects.at(1)->asString(), QStringLiteral("second"));
+    QCOMPARE(res->property(subject)->asString(), QStringLiteral("first"));
+
+    QVERIFY(!other->hasProperty(title));
+    QVERIFY(res->property(PropertyPtr(new Property(QStringLiteral("http://example.com/unknown"))))->isNull());
+
+    // properties and subjects from outside the model are looked up by their URI
+    const PropertyPtr externalTitle(new Property(QStringLiteral("http://example.com/title")));
+    QCOMPARE(res->property(externalTitle)->asString(), QStringLiteral("Title"));
+    const ResourcePtr external(new Resource(QStringLiteral("http://example.com/item")));
+    QCOMPARE(model.resourceProperty(external.data(), title)->asString(), QStringLiteral("Title"));
+}
+
+void TestRDFModel::testRemoveStatement()
+{
+    Model model;
+    const PropertyPtr type = RDFVocab::self()->type();
+    const ResourcePtr item = model.createResource(QStringLiteral("http://example.com/item"));
+    const ResourcePtr image = model.createResource(QStringLiteral("http://example.com/image"));
+    const ResourcePtr res = model.createResource(QStringLiteral("http://example.com/res"));
+    const PropertyPtr subject = model.createProperty(QStringLiteral("http://example.com/subject"));
+
+    const StatementPtr isItem = model.addStatement(res, type, item);
+    model.addStatement(res, type, image);
+    const LiteralPtr first = model.createLiteral(QStringLiteral("first"));
+    model.addStatement(res, subject, first);
+    const StatementPtr second = model.addStatement(res, subject, model.createLiteral(QStringLiteral("second")));
+
+    model.removeStatement(isItem);
+    QVERIFY(model.resourcesWithType(item).isEmpty());
+    QCOMPARE(model.resourcesWithType(image).size(), 1);
+    QCOMPARE(res->properties(type).size(), 1);
+    QCOMPARE(res->property(type)->asResource()->uri(), image->uri());
+
+    model.removeStatement(res, subject, first);
+    QCOMPARE(res->properties(subject).size(), 1);
+    QCOMPARE(res->property(subject)->asString(), QStringLiteral("second"));
+
+    // removing a statement twice does nothing
+    model.removeStatement(res, subject, first);
+    QCOMPARE(res->properties(subject).size(), 1);
+
+    model.removeStatement(second);
+    QVERIFY(!res->hasProperty(subject));
+    QVERIFY(res->property(subject)->isNull());
+    QVERIFY(res->properties(subject).isEmpty());
+
+    // adding the statement again restores the lookups
+    model.addStatement(res, type, item);
+    QCOMPARE(model.resourcesWithType(item).size(), 1);
+    QCOMPARE(res->properties(type).size(), 2);
+    QCOMPARE(model.statements().size(), 2);
+}
+
+void TestRDFModel::testAnonymousResources()
+{
+    Model model;
+    const PropertyPtr type = RDFVocab::self()->type();
+    const PropertyPtr title = model.createProperty(QStringLiteral("http://example.com/title"));
+    const ResourcePtr item = model.createResource(QStringLiteral("http://example.com/item"));
+
+    const ResourcePtr anon1 = model.createResource();
+    const ResourcePtr anon2 = model.createResource();
+    QVERIFY(anon1->isAnon());
+    QVERIFY(anon2->isAnon());
+    QVERIFY(anon1->uri() != anon2->uri());
+
+    model.addStatement(anon1, title, model.createLiteral(QStringLiteral("first")));
+    model.addStatement(anon2, title, model.createLiteral(QStringLiteral("second")));
+    model.addStatement(anon2, type, item);
+
+    QCOMPARE(anon1->property(title)->asString(), QStringLiteral("first"));
+    QCOMPARE(anon2->property(title)->asString(), QStringLiteral("second"));
+    QVERIFY(!anon1->hasProperty(type));
+
+    const QList<ResourcePtr> items = model.resourcesWithType(item);
+    QCOMPARE(items.size(), 1);
+    QVERIFY(items.at(0)->isAnon());
+    QCOMPARE(items.at(0)->uri(), anon2->uri());
+
+    // an anonymous object is found by the statement referencing it
+    const PropertyPtr link = model.createProperty(QStringLiteral("http://example.com/link"));
+    model.addStatement(item, link, anon1);
+    const ResourcePtr object = item->property(link)->asResource();
+    QVERIFY(object->isAnon());
+    QCOMPARE(object->property(title)->asString(), QStringLiteral("first"));
+
+    model.removeStatement(anon2, type, item);
+    QVERIFY(model.resourcesWithType(item).isEmpty());
+    QCOMPARE(anon2->property(title)->asString(), QStringLiteral("second"));
+}
+
+QTEST_MAIN(TestRDFModel)
+
+#include "moc_testrdfmodel.cpp"
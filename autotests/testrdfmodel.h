@@ -0,0 +1,25 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_TESTS_TESTRDFMODEL_H
+#define SYNDICATION_TESTS_TESTRDFMODEL_H
+
+#include <QTest>
+
+class TestRDFModel : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void testResourcesWithType();
+    void testPropertyLookup();
+    void testRemoveStatement();
+    void testAnonymousResources();
+};
+
+#endif // SYNDICATION_TESTS_TESTRDFMODEL_H
@@ -18,6 +18,7 @@
 #include <syndication/atom/parser.h>
 #include <syndication/atom/person.h>
 #include <syndication/atom/source.h>
+#include <syndication/atom/streamreader.h>
 
 namespace Syndication
 {
@@ -6,6 +6,7 @@
 */
 
 #include "constants.h"
+#include "textescaping_p.h"
 #include "tools.h"
 
 #include <syndication/elementwrapper.h>
@@ -29,12 +30,7 @@ QString extractAtomText(const Syndication::ElementWrapper &parent, const QString
     QString type = el.attribute(QStringLiteral("type"), QStringLiteral("text"));
 
     if (type == QLatin1String("text")) {
-        str = parent.extractElementTextNS(atom1Namespace(), tagname).trimmed();
-        if (isCDATA) {
-            str = resolveEntities(str);
-        }
-
-        str = escapeSpecialCharacters(str);
+        str = escapeText(parent.extractElementTextNS(atom1Namespace(), tagname), isCDATA ? ResolveEntities : TextEscapeOptions());
     } else if (type == QLatin1String("html")) {
         str = parent.extractElementTextNS(atom1Namespace(), tagname).trimmed();
     } else if (type == QLatin1String("xhtml")) {
@@ -97,19 +97,17 @@ Content::Format Content::mapTypeToFormat(const QString &typep, const QString &sr
         return PlainText;
     }
 
-    static QStringList xmltypes;
-    if (xmltypes.isEmpty()) {
-        xmltypes.reserve(8);
-        xmltypes.append(QStringLiteral("xhtml"));
-        xmltypes.append(QStringLiteral("application/xhtml+xml"));
+    static const QStringList xmltypes = {
+        QStringLiteral("xhtml"),
+        QStringLiteral("application/xhtml+xml"),
         // XML media types as defined in RFC3023:
-        xmltypes.append(QStringLiteral("text/xml"));
-        xmltypes.append(QStringLiteral("application/xml"));
-        xmltypes.append(QStringLiteral("text/xml-external-parsed-entity"));
-        xmltypes.append(QStringLiteral("application/xml-external-parsed-entity"));
-        xmltypes.append(QStringLiteral("application/xml-dtd"));
-        xmltypes.append(QStringLiteral("text/x-dtd")); // from shared-mime-info
-    }
+        QStringLiteral("text/xml"),
+        QStringLiteral("application/xml"),
+        QStringLiteral("text/xml-external-parsed-entity"),
+        QStringLiteral("application/xml-external-parsed-entity"),
+        QStringLiteral("application/xml-dtd"),
+        QStringLiteral("text/x-dtd"), // from shared-mime-info
+    };
 
     /* clang-format off */
     if (xmltypes.contains(type)
@@ -15,14 +15,13 @@
 #include "person.h"
 
 #include <documentvisitor.h>
+#include <elementnameset_p.h>
 #include <tools.h>
 
 #include <QDomElement>
 #include <QList>
 #include <QString>
 
-#include <vector>
-
 namespace Syndication
 {
 namespace Atom
@@ -156,35 +155,37 @@ QList<Entry> FeedDocument::entries() const
     return list;
 }
 
-QList<QDomElement> FeedDocument::unhandledElements() const
+namespace
 {
-    // TODO: do not hardcode this list here
-    static std::vector<ElementType> handled; // QVector would require a default ctor, and ElementType is too big for QList
-    if (handled.empty()) {
-        handled.reserve(13);
-        handled.push_back(ElementType(QStringLiteral("author"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("contributor"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("category"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("generator"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("icon"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("logo"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("id"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("rights"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("title"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("subtitle"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("updated"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("link"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("entry"), atom1Namespace()));
-    }
+constexpr QLatin1String atomNs("http://www.w3.org/2005/Atom"); // atom1Namespace()
+
+// the child elements covered by the accessors of FeedDocument
+constexpr ElementName feedDocumentElements[] = {
+    {atomNs, QLatin1String("author")},
+    {atomNs, QLatin1String("contributor")},
+    {atomNs, QLatin1String("category")},
+    {atomNs, QLatin1String("generator")},
+    {atomNs, QLatin1String("icon")},
+    {atomNs, QLatin1String("logo")},
+    {atomNs, QLatin1String("id")},
+    {atomNs, QLatin1String("rights")},
+    {atomNs, QLatin1String("title")},
+    {atomNs, QLatin1String("subtitle")},
+    {atomNs, QLatin1String("updated")},
+    {atomNs, QLatin1String("link")},
+    {atomNs, QLatin1String("entry")},
+};
+constexpr auto handledFeedDocumentElements = makeElementNameSet<64, 7>(feedDocumentElements);
+} // namespace
 
+QList<QDomElement> FeedDocument::unhandledElements() const
+{
     QList<QDomElement> notHandled;
 
-    QDomNodeList children = element().childNodes();
-    const int numChildren = children.size();
-    for (int i = 0; i < numChildren; ++i) {
-        QDomElement el = children.at(i).toElement();
+    for (QDomNode n = element().firstChild(); !n.isNull(); n = n.nextSibling()) {
+        const QDomElement el = n.toElement();
         if (!el.isNull() //
-            && std::find(handled.cbegin(), handled.cend(), ElementType(el.localName(), el.namespaceURI())) == handled.cend()) {
+            && !handledFeedDocumentElements.contains(el.namespaceURI(), el.localName())) {
             notHandled.append(el);
         }
     }
@@ -14,14 +14,13 @@
 #include "person.h"
 #include "source.h"
 
+#include <elementnameset_p.h>
 #include <specificitemvisitor.h>
 #include <tools.h>
 
 #include <QDomElement>
 #include <QString>
 
-#include <vector>
-
 namespace Syndication
 {
 namespace Atom
@@ -140,34 +139,36 @@ Content Entry::content() const
     return Content(firstElementByTagNameNS(atom1Namespace(), QStringLiteral("content")));
 }
 
+namespace
+{
+constexpr QLatin1String atomNs("http://www.w3.org/2005/Atom"); // atom1Namespace()
+
+// the child elements covered by the accessors of Entry
+constexpr ElementName entryElements[] = {
+    {atomNs, QLatin1String("author")},
+    {atomNs, QLatin1String("contributor")},
+    {atomNs, QLatin1String("category")},
+    {atomNs, QLatin1String("id")},
+    {atomNs, QLatin1String("link")},
+    {atomNs, QLatin1String("rights")},
+    {atomNs, QLatin1String("source")},
+    {atomNs, QLatin1String("published")},
+    {atomNs, QLatin1String("updated")},
+    {atomNs, QLatin1String("summary")},
+    {atomNs, QLatin1String("title")},
+    {atomNs, QLatin1String("content")},
+};
+constexpr auto handledEntryElements = makeElementNameSet<32, 15>(entryElements);
+} // namespace
+
 QList<QDomElement> Entry::unhandledElements() const
 {
-    // TODO: do not hardcode this list here
-    static std::vector<ElementType> handled; // QVector would require a default ctor, and ElementType is too big for QList
-    if (handled.empty()) {
-        handled.reserve(12);
-        handled.push_back(ElementType(QStringLiteral("author"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("contributor"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("category"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("id"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("link"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("rights"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("source"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("published"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("updated"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("summary"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("title"), atom1Namespace()));
-        handled.push_back(ElementType(QStringLiteral("content"), atom1Namespace()));
-    }
-
     QList<QDomElement> notHandled;
 
-    QDomNodeList children = element().childNodes();
-    const int numChildren = children.size();
-    for (int i = 0; i < numChildren; ++i) {
-        QDomElement el = children.at(i).toElement();
+    for (QDomNode n = element().firstChild(); !n.isNull(); n = n.nextSibling()) {
+        const QDomElement el = n.toElement();
         if (!el.isNull() //
-            && std::find(handled.cbegin(), handled.cend(), ElementType(el.localName(), el.namespaceURI())) == handled.cend()) {
+            && !handledEntryElements.contains(el.namespaceURI(), el.localName())) {
             notHandled.append(el);
         }
     }
@@ -9,6 +9,7 @@
 #include "constants.h"
 #include "content.h"
 #include "document.h"
+#include "documentsniffer_p.h"
 
 #include <documentsource.h>
 
@@ -35,6 +36,15 @@ public:
 
 bool Parser::accept(const Syndication::DocumentSource &source) const
 {
+    // reject other documents before building a DOM
+    const QByteArray data = source.asByteArray();
+    const SniffedRoot sniffed = sniffRootElement(data);
+    if (sniffed.result == SniffedRoot::NotXml
+        || (sniffed.result == SniffedRoot::Found && QLatin1String(sniffed.namespaceURI) != atom1Namespace()
+            && QLatin1String(sniffed.namespaceURI) != atom0_3Namespace())) {
+        return false;
+    }
+
     QDomElement root = source.asDomDocument().documentElement();
     return !root.isNull() && (root.namespaceURI() == atom1Namespace() || root.namespaceURI() == atom0_3Namespace());
 }
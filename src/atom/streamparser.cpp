@@ -0,0 +1,53 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "streamparser.h"
+#include "constants.h"
+#include "document.h"
+#include "streamreader.h"
+
+#include <documentsource.h>
+
+#include <QString>
+#include <QXmlStreamReader>
+
+namespace Syndication
+{
+namespace Atom
+{
+StreamParser::StreamParser() = default;
+
+StreamParser::~StreamParser() = default;
+
+bool StreamParser::accept(const Syndication::DocumentSource &source) const
+{
+    QXmlStreamReader reader(source.asByteArray());
+    while (!reader.atEnd()) {
+        if (reader.readNext() == QXmlStreamReader::StartElement) {
+            return reader.name() == QLatin1String("feed") && reader.namespaceUri() == atom1Namespace();
+        }
+    }
+    return false;
+}
+
+Syndication::SpecificDocumentPtr StreamParser::parse(const Syndication::DocumentSource &source) const
+{
+    StreamReader reader;
+    reader.addData(source.asByteArray());
+    if (reader.hasError() || !reader.isComplete()) {
+        return FeedDocumentPtr(new FeedDocument());
+    }
+    return FeedDocumentPtr(new FeedDocument(reader.feed()));
+}
+
+QString StreamParser::format() const
+{
+    return QStringLiteral("atomstream");
+}
+
+} // namespace Atom
+} // namespace Syndication
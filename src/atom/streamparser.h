@@ -0,0 +1,57 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_ATOM_STREAMPARSER_H
+#define SYNDICATION_ATOM_STREAMPARSER_H
+
+#include <syndication/abstractparser.h>
+
+namespace Syndication
+{
+class DocumentSource;
+
+namespace Atom
+{
+/*!
+ * \internal
+ *
+ * Parser implementation reading Atom 1.0 feeds with StreamReader.
+ * Registered in the global parser collection with the format string
+ * "atomstream"; pass it as format hint to Syndication::parse() to use it.
+ */
+class StreamParser : public Syndication::AbstractParser
+{
+public:
+    StreamParser();
+    ~StreamParser() override;
+
+    /*!
+     * returns whether the root element of the source is an Atom 1.0
+     * feed element. Only the prolog and the root start tag are read.
+     */
+    bool accept(const Syndication::DocumentSource &source) const override;
+
+    /*!
+     * reads the source with a StreamReader. Returns an invalid
+     * FeedDocument if the source is not a well-formed Atom 1.0 feed.
+     */
+    Syndication::SpecificDocumentPtr parse(const Syndication::DocumentSource &source) const override;
+
+    /*!
+     * Returns \c "atomstream"
+     */
+    QString format() const override;
+
+private:
+    StreamParser(const StreamParser &other);
+    StreamParser &operator=(const StreamParser &other);
+};
+
+} // namespace Atom
+} // namespace Syndication
+
+#endif // SYNDICATION_ATOM_STREAMPARSER_H
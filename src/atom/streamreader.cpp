@@ -0,0 +1,196 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "streamreader.h"
+#include "constants.h"
+#include "document.h"
+#include "entry.h"
+#include "person.h"
+
+#include <xmlsubtreewriter_p.h>
+
+#include <QByteArray>
+#include <QDomDocument>
+#include <QDomElement>
+#include <QList>
+#include <QString>
+#include <QXmlStreamReader>
+
+namespace Syndication
+{
+namespace Atom
+{
+class SYNDICATION_NO_EXPORT StreamReader::StreamReaderPrivate
+{
+public:
+    void process();
+    void startElement();
+    void endElement();
+    void createRoot();
+    QDomElement parseSubtree(const QString &xml) const;
+
+    QXmlStreamReader reader;
+    XmlScopeStack scopes;
+    XmlSubtreeWriter subtree;
+    EntryHandler entryHandler;
+
+    QDomDocument headDoc;
+    QDomElement root;
+
+    bool subtreeIsEntry = false;
+    bool complete = false;
+    bool failed = false;
+};
+
+StreamReader::StreamReader()
+    : d(new StreamReaderPrivate)
+{
+    d->reader.setNamespaceProcessing(true);
+}
+
+StreamReader::~StreamReader() = default;
+
+void StreamReader::setEntryHandler(const EntryHandler &handler)
+{
+    d->entryHandler = handler;
+}
+
+void StreamReader::addData(const QByteArray &data)
+{
+    if (d->failed || d->complete) {
+        return;
+    }
+    d->reader.addData(data);
+    d->process();
+}
+
+bool StreamReader::hasError() const
+{
+    return d->failed;
+}
+
+bool StreamReader::isComplete() const
+{
+    return d->complete;
+}
+
+FeedDocument StreamReader::feed() const
+{
+    return FeedDocument(d->root);
+}
+
+void StreamReader::StreamReaderPrivate::process()
+{
+    while (!complete && !failed) {
+        switch (reader.readNext()) {
+        case QXmlStreamReader::StartElement:
+            startElement();
+            break;
+        case QXmlStreamReader::EndElement:
+            endElement();
+            break;
+        case QXmlStreamReader::Characters:
+        case QXmlStreamReader::Comment:
+        case QXmlStreamReader::ProcessingInstruction:
+        case QXmlStreamReader::EntityReference:
+            subtree.write(reader);
+            break;
+        case QXmlStreamReader::Invalid:
+            // running out of data is not an error, reading resumes with the next chunk
+            if (reader.error() != QXmlStreamReader::PrematureEndOfDocumentError) {
+                failed = true;
+            }
+            return;
+        case QXmlStreamReader::EndDocument:
+            return;
+        default:
+            break;
+        }
+    }
+}
+
+void StreamReader::StreamReaderPrivate::startElement()
+{
+    scopes.push(reader);
+
+    if (subtree.isActive()) {
+        subtree.write(reader);
+        return;
+    }
+
+    if (scopes.depth() == 1) {
+        if (reader.name() != QLatin1String("feed") || reader.namespaceUri() != atom1Namespace()) {
+            failed = true;
+            return;
+        }
+        createRoot();
+        return;
+    }
+
+    // a child of atom:feed. Entries passed to the handler are used on their
+    // own and so carry the inherited context, everything else is added to
+    // the head document
+    subtreeIsEntry = reader.name() == QLatin1String("entry") && reader.namespaceUri() == atom1Namespace();
+    subtree.start(reader, scopes, subtreeIsEntry && entryHandler);
+}
+
+void StreamReader::StreamReaderPrivate::endElement()
+{
+    scopes.pop();
+
+    if (subtree.isActive()) {
+        if (!subtree.write(reader)) {
+            return;
+        }
+
+        const QDomElement element = parseSubtree(subtree.take());
+        if (element.isNull()) {
+            return;
+        }
+        if (!subtreeIsEntry || !entryHandler) {
+            root.appendChild(headDoc.importNode(element, true));
+            return;
+        }
+
+        Entry entry(element);
+        entry.setFeedAuthors(FeedDocument(root).authors());
+        entryHandler(entry);
+        return;
+    }
+
+    if (scopes.depth() == 0) {
+        complete = true;
+    }
+}
+
+void StreamReader::StreamReaderPrivate::createRoot()
+{
+    root = headDoc.createElementNS(reader.namespaceUri().toString(), reader.qualifiedName().toString());
+
+    const QXmlStreamAttributes attributes = reader.attributes();
+    for (const QXmlStreamAttribute &attribute : attributes) {
+        if (attribute.namespaceUri().isEmpty()) {
+            root.setAttribute(attribute.name().toString(), attribute.value().toString());
+        } else {
+            root.setAttributeNS(attribute.namespaceUri().toString(), attribute.qualifiedName().toString(), attribute.value().toString());
+        }
+    }
+
+    headDoc.appendChild(root);
+}
+
+QDomElement StreamReader::StreamReaderPrivate::parseSubtree(const QString &xml) const
+{
+    QDomDocument doc;
+    if (!doc.setContent(xml, QDomDocument::ParseOption::UseNamespaceProcessing)) {
+        return QDomElement();
+    }
+    return doc.documentElement();
+}
+
+} // namespace Atom
+} // namespace Syndication
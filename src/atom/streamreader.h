@@ -0,0 +1,115 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_ATOM_STREAMREADER_H
+#define SYNDICATION_ATOM_STREAMREADER_H
+
+#include "syndication_export.h"
+
+#include <QtGlobal>
+
+#include <functional>
+#include <memory>
+
+class QByteArray;
+
+namespace Syndication
+{
+namespace Atom
+{
+class Entry;
+class FeedDocument;
+
+/*!
+ * \class Syndication::Atom::StreamReader
+ * \inmodule Syndication
+ * \inheaderfile Syndication/Atom/StreamReader
+ *
+ * \brief Incremental reader for Atom 1.0 feed documents.
+ *
+ * The document is read with QXmlStreamReader as data is added, without
+ * building a DOM tree for the whole document. Each entry is handed to the
+ * entry handler as soon as its end tag was read, so entries of a large
+ * feed can be processed while the rest is still being read, and only one
+ * entry is kept in memory at a time:
+ *
+ * \code
+ * Atom::StreamReader reader;
+ * reader.setEntryHandler([](const Atom::Entry &entry) {
+ *     store(entry.id(), entry.title());
+ * });
+ * while (hasMoreData()) {
+ *     reader.addData(nextChunk());
+ * }
+ * \endcode
+ *
+ * The entries passed to the handler carry the xml:base and xml:lang in
+ * effect in the document, and know the feed authors read so far (Atom
+ * feeds usually list these before the first entry).
+ *
+ * Without an entry handler, entries are collected in the document
+ * returned by feed(). Atom 0.3 is not supported.
+ */
+class SYNDICATION_EXPORT StreamReader
+{
+public:
+    /*!
+     * function called for every complete entry
+     */
+    typedef std::function<void(const Syndication::Atom::Entry &entry)> EntryHandler;
+
+    /*!
+     * creates a reader without entry handler
+     */
+    StreamReader();
+
+    ~StreamReader();
+
+    /*!
+     * sets the function to call for each complete entry. Entries read
+     * after this call are no longer added to feed().
+     *
+     * \a handler the entry handler, or an empty function to collect
+     * entries in feed() again
+     */
+    void setEntryHandler(const EntryHandler &handler);
+
+    /*!
+     * appends \a data to the input and reads all complete elements,
+     * calling the entry handler for each entry closed by the new data
+     */
+    void addData(const QByteArray &data);
+
+    /*!
+     * Returns \c true if the input is not well-formed XML or not an
+     * Atom 1.0 feed document. Further data is ignored after an error.
+     */
+    Q_REQUIRED_RESULT bool hasError() const;
+
+    /*!
+     * Returns \c true if the end tag of the feed element was read
+     */
+    Q_REQUIRED_RESULT bool isComplete() const;
+
+    /*!
+     * Returns the feed metadata read so far, plus the entries read so far
+     * if no entry handler is set. Returns a null document if no feed
+     * element was read yet.
+     */
+    Q_REQUIRED_RESULT Syndication::Atom::FeedDocument feed() const;
+
+private:
+    Q_DISABLE_COPY(StreamReader)
+
+    class StreamReaderPrivate;
+    std::unique_ptr<StreamReaderPrivate> const d;
+};
+
+} // namespace Atom
+} // namespace Syndication
+
+#endif // SYNDICATION_ATOM_STREAMREADER_H
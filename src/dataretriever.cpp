@@ -17,6 +17,20 @@ DataRetriever::~DataRetriever()
 {
 }
 
+ConditionalDataRetriever::ConditionalDataRetriever()
+{
+}
+
+ConditionalDataRetriever::~ConditionalDataRetriever()
+{
+}
+
+void ConditionalDataRetriever::retrieveData(const QUrl &url, const FeedValidators &validators)
+{
+    Q_UNUSED(validators)
+    retrieveData(url);
+}
+
 } // namespace Syndication
 
 #include "moc_dataretriever.cpp"
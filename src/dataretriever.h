@@ -10,6 +10,7 @@
 #include "syndication_export.h"
 
 #include <QObject>
+#include <QString>
 
 class QUrl;
 
@@ -17,6 +18,36 @@ class QByteArray;
 
 namespace Syndication
 {
+/*!
+ * \class Syndication::FeedValidators
+ * \inmodule Syndication
+ * \inheaderfile Syndication/DataRetriever
+ *
+ * \brief The HTTP cache validators of a retrieved feed.
+ *
+ * Store them with the feed and pass them to Loader::loadFrom() the next
+ * time, so that an unchanged feed is neither downloaded nor parsed again.
+ */
+struct FeedValidators {
+    /*!
+     * the value of the ETag header, sent back as If-None-Match
+     */
+    QString entityTag;
+
+    /*!
+     * the value of the Last-Modified header, sent back as If-Modified-Since
+     */
+    QString lastModified;
+
+    /*!
+     * Returns \c true if neither validator is set
+     */
+    bool isEmpty() const
+    {
+        return entityTag.isEmpty() && lastModified.isEmpty();
+    }
+};
+
 /*!
  * \class Syndication::DataRetriever
  * \inmodule Syndication
@@ -83,11 +114,93 @@ Q_SIGNALS:
      */
     void dataRetrieved(const QByteArray &data, bool success);
 
+    /*!
+     * Emit this signal for every chunk of data as it arrives, if the
+     * retrieval algorithm reads the data incrementally. The Loader then
+     * parses the document while it is still being retrieved.
+     *
+     * The chunks must add up to the data passed to dataRetrieved(),
+     * which still has to be emitted once the retrieval process finished.
+     *
+     * \note RSS 0.9x/2.0 documents received this way are read with the
+     * streaming parser, like with the "rss2stream" format hint of parse().
+     * The specific document of the resulting feed then is a
+     * RSS2::StreamDocument, which does not accept DocumentVisitors.
+     * Retrievers whose users need the DOM based RSS2::Document should only
+     * emit dataRetrieved().
+     *
+     * \a data the next chunk of data
+     */
+    void dataReceived(const QByteArray &data);
+
+    /*!
+     * Emit this signal to tell the Loader class the cache validators of the
+     * retrieved data, e.g. the ETag and Last-Modified headers of a HTTP
+     * response. It has to be emitted before dataRetrieved() or
+     * notModified().
+     *
+     * \a validators the validators of the retrieved data
+     *
+     * \sa ConditionalDataRetriever, Loader::validators()
+     */
+    void validatorsReceived(const Syndication::FeedValidators &validators);
+
+    /*!
+     * Emit this signal instead of dataRetrieved() to tell the Loader class
+     * that the data did not change since it was retrieved with the
+     * validators passed to ConditionalDataRetriever::retrieveData().
+     *
+     * The Loader then emits Loader::loadingComplete() with NotModified
+     * and a null feed.
+     */
+    void notModified();
+
 private:
     DataRetriever(const DataRetriever &other);
     DataRetriever &operator=(const DataRetriever &other);
 };
 
+/*!
+ * \class Syndication::ConditionalDataRetriever
+ * \inmodule Syndication
+ * \inheaderfile Syndication/DataRetriever
+ *
+ * \brief Abstract baseclass for data retrievers supporting conditional requests.
+ *
+ * Subclass this instead of DataRetriever if the retrieval algorithm can
+ * send cache validators, e.g. HTTP retrievers. The Loader then passes the
+ * validators given to Loader::loadFrom(), and the retriever emits
+ * notModified() if the data did not change.
+ */
+class SYNDICATION_EXPORT ConditionalDataRetriever : public DataRetriever
+{
+    Q_OBJECT
+public:
+    /*!
+     * Default constructor.
+     */
+    ConditionalDataRetriever();
+
+    ~ConditionalDataRetriever() override;
+
+    using DataRetriever::retrieveData;
+
+    /*!
+     * Retrieve data from the given URL, unless it did not change since
+     * it was retrieved with \a validators.
+     *
+     * The default implementation ignores the validators and calls
+     * retrieveData(const QUrl &).
+     *
+     * \a url the URL to retrieve data from
+     *
+     * \a validators the validators reported the last time, might be empty
+     *
+     * \sa DataRetriever::notModified(), DataRetriever::validatorsReceived()
+     */
+    virtual void retrieveData(const QUrl &url, const FeedValidators &validators);
+};
+
 } // namespace Syndication
 
 #endif // SYNDICATION_DATARETRIEVER_H
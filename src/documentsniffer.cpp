@@ -0,0 +1,225 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "documentsniffer_p.h"
+
+#include <QByteArray>
+#include <QXmlStreamReader>
+
+#include <cstring>
+
+namespace Syndication
+{
+namespace
+{
+// the root element of feeds comes right after a short prolog
+const qsizetype sniffLimit = 4096;
+
+bool isXmlSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool endsName(char c)
+{
+    return isXmlSpace(c) || c == '/' || c == '>' || c == '=';
+}
+} // namespace
+
+SniffedRoot sniffRootElement(const QByteArray &data)
+{
+    SniffedRoot root;
+    if (data.isEmpty()) {
+        root.result = SniffedRoot::NotXml;
+        return root;
+    }
+
+    const QByteArrayView view = QByteArrayView(data).first(qMin(data.size(), sniffLimit));
+    const qsizetype size = view.size();
+    const char *s = view.data();
+
+    // hitting the end of the window only tells something if it is the end of the data
+    const bool complete = size == data.size();
+    const auto endOfWindow = [&root, complete]() {
+        root.result = complete ? SniffedRoot::NotXml : SniffedRoot::Unknown;
+        return root;
+    };
+    const auto notXml = [&root]() {
+        root.result = SniffedRoot::NotXml;
+        return root;
+    };
+
+    // UTF-16 and UTF-32 are left to the XML parser
+    if (std::memchr(s, 0, size) || view.startsWith("\xFE\xFF") || view.startsWith("\xFF\xFE")) {
+        return root;
+    }
+
+    qsizetype i = view.startsWith("\xEF\xBB\xBF") ? 3 : 0;
+
+    // skip the prolog
+    while (true) {
+        while (i < size && isXmlSpace(s[i])) {
+            ++i;
+        }
+        if (i + 1 >= size) {
+            return i < size && s[i] != '<' ? notXml() : endOfWindow();
+        }
+        if (s[i] != '<') {
+            return notXml();
+        }
+
+        const QByteArrayView rest = view.sliced(i);
+        qsizetype end;
+        if (rest.startsWith("<?")) {
+            end = view.indexOf("?>", i + 2);
+            if (end == -1) {
+                return endOfWindow();
+            }
+            i = end + 2;
+        } else if (rest.startsWith("<!--")) {
+            end = view.indexOf("-->", i + 4);
+            if (end == -1) {
+                return endOfWindow();
+            }
+            i = end + 3;
+        } else if (rest.startsWith("<!DOCTYPE")) {
+            end = i + 9;
+            char quote = 0;
+            while (end < size && (quote || s[end] != '>')) {
+                if (quote) {
+                    quote = s[end] == quote ? 0 : quote;
+                } else if (s[end] == '"' || s[end] == '\'') {
+                    quote = s[end];
+                } else if (s[end] == '[') {
+                    // the internal subset might declare entities or default attributes
+                    return root;
+                }
+                ++end;
+            }
+            if (end == size) {
+                return endOfWindow();
+            }
+            i = end + 1;
+        } else if (s[i + 1] == '!') {
+            // a truncated comment or document type, or something that is neither
+            const bool truncated = QByteArrayView("<!--").startsWith(rest) || QByteArrayView("<!DOCTYPE").startsWith(rest);
+            return truncated ? endOfWindow() : notXml();
+        } else {
+            break;
+        }
+    }
+
+    // the start tag of the root element
+    const qsizetype nameStart = ++i;
+    while (i < size && !endsName(s[i])) {
+        ++i;
+    }
+    if (i == size) {
+        return endOfWindow();
+    }
+    if (i == nameStart) {
+        return notXml();
+    }
+    const QByteArrayView qualifiedName = view.sliced(nameStart, i - nameStart);
+    const qsizetype colon = qualifiedName.indexOf(':');
+    const QByteArrayView prefix = colon == -1 ? QByteArrayView() : qualifiedName.first(colon);
+
+    QByteArrayView namespaceURI;
+    bool namespaceDeclared = false;
+    while (true) {
+        const qsizetype attributeStart = i;
+        while (i < size && isXmlSpace(s[i])) {
+            ++i;
+        }
+        if (i == size) {
+            return endOfWindow();
+        }
+        if (s[i] == '>') {
+            break;
+        }
+        if (s[i] == '/') {
+            if (i + 1 == size) {
+                return endOfWindow();
+            }
+            if (s[i + 1] == '>') {
+                break;
+            }
+            return notXml();
+        }
+        // attributes have to be separated by whitespace
+        if (i == attributeStart) {
+            return notXml();
+        }
+
+        const qsizetype attributeNameStart = i;
+        while (i < size && !endsName(s[i])) {
+            ++i;
+        }
+        const QByteArrayView attributeName = view.sliced(attributeNameStart, i - attributeNameStart);
+        while (i < size && isXmlSpace(s[i])) {
+            ++i;
+        }
+        if (i == size) {
+            return endOfWindow();
+        }
+        if (attributeName.isEmpty() || s[i] != '=') {
+            return notXml();
+        }
+        ++i;
+        while (i < size && isXmlSpace(s[i])) {
+            ++i;
+        }
+        if (i == size) {
+            return endOfWindow();
+        }
+        if (s[i] != '"' && s[i] != '\'') {
+            return notXml();
+        }
+        const qsizetype valueEnd = view.indexOf(s[i], i + 1);
+        if (valueEnd == -1) {
+            return endOfWindow();
+        }
+        const QByteArrayView value = view.sliced(i + 1, valueEnd - i - 1);
+        if (value.contains('<')) {
+            return notXml();
+        }
+        i = valueEnd + 1;
+
+        const bool declaresNamespace = prefix.isEmpty() ? attributeName == "xmlns" : attributeName.startsWith("xmlns:") && attributeName.sliced(6) == prefix;
+        if (declaresNamespace) {
+            // leave entities and attribute value normalization to the XML parser
+            for (const char c : value) {
+                if (c == '&' || isXmlSpace(c)) {
+                    return root;
+                }
+            }
+            namespaceURI = value;
+            namespaceDeclared = true;
+        }
+    }
+
+    // an undeclared prefix is left to the XML parser to report
+    if (!prefix.isEmpty() && !namespaceDeclared) {
+        return root;
+    }
+
+    root.result = SniffedRoot::Found;
+    root.qualifiedName = qualifiedName;
+    root.namespaceURI = namespaceURI;
+    return root;
+}
+
+bool isWellFormedXml(const QByteArray &data)
+{
+    QXmlStreamReader reader(data);
+    while (!reader.atEnd()) {
+        reader.readNext();
+    }
+    return !reader.hasError();
+}
+
+} // namespace Syndication
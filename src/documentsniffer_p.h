@@ -0,0 +1,65 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_DOCUMENTSNIFFER_P_H
+#define SYNDICATION_DOCUMENTSNIFFER_P_H
+
+#include <QByteArrayView>
+
+class QByteArray;
+
+namespace Syndication
+{
+//@cond PRIVATE
+/*!
+ * \internal
+ * the root element of a document, as far as sniffRootElement() could tell
+ */
+struct SniffedRoot {
+    enum Result {
+        Unknown, // could not be determined without parsing the whole document
+        NotXml, // the document is certainly not well-formed XML
+        Found, // qualifiedName and namespaceURI are set
+    };
+
+    Result result = Unknown;
+    QByteArrayView qualifiedName;
+    QByteArrayView namespaceURI;
+
+    // returns true if the document can only have a root element with a different
+    // qualified name than \a name, or is no XML at all
+    bool excludesName(QByteArrayView name) const
+    {
+        return result == NotXml || (result == Found && qualifiedName != name);
+    }
+};
+
+/*!
+ * \internal
+ *
+ * Looks for the root element in the first few kilobytes of \a data, without
+ * building a DOM. The prolog (XML declaration, comments, processing
+ * instructions and a document type without internal subset) is skipped.
+ * Documents in encodings that are not ASCII compatible result in
+ * SniffedRoot::Unknown, as do namespace declarations using entities.
+ *
+ * The views of the result point into \a data.
+ */
+SniffedRoot sniffRootElement(const QByteArray &data);
+
+/*!
+ * \internal
+ *
+ * Returns whether \a data is well-formed XML, checked in a single pass
+ * without building a DOM.
+ */
+bool isWellFormedXml(const QByteArray &data);
+//@endcond
+
+} // namespace Syndication
+
+#endif // SYNDICATION_DOCUMENTSNIFFER_P_H
@@ -6,6 +6,7 @@
 */
 
 #include "documentsource.h"
+#include "instrumentation_p.h"
 #include "tools.h"
 
 #include <QByteArray>
@@ -23,6 +24,8 @@ public:
     mutable bool parsed;
     mutable unsigned int hash;
     mutable bool calculatedHash;
+    mutable quint64 digest = 0;
+    mutable bool calculatedDigest = false;
 };
 
 DocumentSource::DocumentSource()
@@ -66,6 +69,7 @@ QByteArray DocumentSource::asByteArray() const
 QDomDocument DocumentSource::asDomDocument() const
 {
     if (!d->parsed) {
+        const StageTimer timer;
         const auto result = d->domDoc.setContent(d->array, QDomDocument::ParseOption::UseNamespaceProcessing);
         if (!result) {
             qWarning() << result.errorMessage << "on line" << result.errorLine;
@@ -73,6 +77,7 @@ QDomDocument DocumentSource::asDomDocument() const
         }
 
         d->parsed = true;
+        timer.finish(Instrumentation::BuildDom, QString(), d->array.size());
     }
 
     return d->domDoc;
@@ -93,6 +98,16 @@ unsigned int DocumentSource::hash() const
     return d->hash;
 }
 
+quint64 DocumentSource::digest() const
+{
+    if (!d->calculatedDigest) {
+        d->digest = calcDigest(d->array);
+        d->calculatedDigest = true;
+    }
+
+    return d->digest;
+}
+
 QString DocumentSource::url() const
 {
     return d->url;
@@ -96,6 +96,19 @@ public:
      */
     Q_REQUIRED_RESULT unsigned int hash() const;
 
+    /*!
+     * Calculates a 64 bit digest of the source array.
+     *
+     * Like hash(), but computed with a stronger and faster function
+     * (XXH64), so that different sources practically never share a
+     * digest. This is what parseDocument() uses to recognize sources it
+     * parsed before, see setParseCacheCapacity().
+     *
+     * Returns the digest of the source, which is the same for all empty
+     * sources
+     */
+    Q_REQUIRED_RESULT quint64 digest() const;
+
     /*!
      * Returns the feed source as DOM document.
      * The document is parsed only on the first call of this method
@@ -0,0 +1,103 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_ELEMENTNAMESET_P_H
+#define SYNDICATION_ELEMENTNAMESET_P_H
+
+#include <QLatin1String>
+#include <QStringView>
+
+#include <cstddef>
+
+namespace Syndication
+{
+//@cond PRIVATE
+/*!
+ * \internal
+ * namespace URI and local name of an element
+ */
+struct ElementName {
+    QLatin1String namespaceURI;
+    QLatin1String localName;
+};
+
+/*!
+ * \internal
+ *
+ * A fixed set of element names, built at compile time, to tell the child
+ * elements a class handles from the unhandled ones without allocating.
+ *
+ * The names are placed into \c Slots slots by a perfect hash of the local
+ * name and the length of the namespace URI. \c Seed has to be chosen so that
+ * no two names share a slot; a collision is detected while the set is built,
+ * and as sets are constexpr, it fails the build.
+ */
+template<std::size_t N, std::size_t Slots, quint32 Seed>
+class ElementNameSet
+{
+public:
+    constexpr explicit ElementNameSet(const ElementName (&names)[N])
+        : m_names{}
+        , m_slots{}
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            m_names[i] = names[i];
+            const std::size_t slot = hash(names[i].localName, names[i].namespaceURI.size()) % Slots;
+            if (m_slots[slot] != 0) {
+                throw "ElementNameSet: two names share a slot, choose another seed";
+            }
+            m_slots[slot] = i + 1;
+        }
+    }
+
+    /*!
+     * returns whether the set contains the element named \a localName in
+     * the namespace \a namespaceURI
+     */
+    bool contains(QStringView namespaceURI, QStringView localName) const noexcept
+    {
+        const std::size_t index = m_slots[hash(localName, namespaceURI.size()) % Slots];
+        if (index == 0) {
+            return false;
+        }
+        const ElementName &name = m_names[index - 1];
+        return name.localName == localName && name.namespaceURI == namespaceURI;
+    }
+
+private:
+    // FNV-1a over the local name, followed by the namespace URI length
+    template<typename View>
+    static constexpr quint32 hash(View localName, qsizetype namespaceSize) noexcept
+    {
+        quint32 h = 2166136261u + Seed;
+        for (qsizetype i = 0; i < localName.size(); ++i) {
+            h ^= quint32(localName.at(i).unicode());
+            h *= 16777619u;
+        }
+        h ^= quint32(namespaceSize);
+        h *= 16777619u;
+        return h;
+    }
+
+    ElementName m_names[N];
+    std::size_t m_slots[Slots]; // index into m_names + 1, 0 if unused
+};
+
+/*!
+ * \internal
+ * creates an ElementNameSet from \a names, deducing the number of names
+ */
+template<std::size_t Slots, quint32 Seed, std::size_t N>
+constexpr ElementNameSet<N, Slots, Seed> makeElementNameSet(const ElementName (&names)[N])
+{
+    return ElementNameSet<N, Slots, Seed>(names);
+}
+//@endcond
+
+} // namespace Syndication
+
+#endif // SYNDICATION_ELEMENTNAMESET_P_H
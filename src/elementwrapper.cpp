@@ -12,12 +12,31 @@
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QHash>
 #include <QIODevice>
 #include <QStringList>
 #include <QTextStream>
 
 namespace Syndication
 {
+namespace
+{
+struct ChildKey {
+    QString namespaceURI;
+    QString localName;
+
+    bool operator==(const ChildKey &other) const
+    {
+        return localName == other.localName && namespaceURI == other.namespaceURI;
+    }
+};
+
+size_t qHash(const ChildKey &key, size_t seed = 0) noexcept
+{
+    return qHashMulti(seed, key.namespaceURI, key.localName);
+}
+} // namespace
+
 class SYNDICATION_NO_EXPORT ElementWrapper::ElementWrapperPrivate
 {
 public:
@@ -27,6 +46,27 @@ public:
     mutable bool xmlBaseParsed;
     mutable QString xmlLang;
     mutable bool xmlLangParsed;
+
+    // the child elements by namespace URI and local name, in document
+    // order. Built in one pass on the first lookup.
+    mutable QHash<ChildKey, QList<QDomElement>> children;
+    mutable bool childrenIndexed = false;
+
+    const QList<QDomElement> *childElements(const QString &nsURI, const QString &localName) const
+    {
+        if (!childrenIndexed) {
+            for (QDomNode n = element.firstChild(); !n.isNull(); n = n.nextSibling()) {
+                if (n.isElement()) {
+                    QDomElement e = n.toElement();
+                    children[ChildKey{e.namespaceURI(), e.localName()}].append(e);
+                }
+            }
+            childrenIndexed = true;
+        }
+
+        const auto it = children.constFind(ChildKey{nsURI, localName});
+        return it != children.constEnd() ? &it.value() : nullptr;
+    }
 };
 
 ElementWrapper::ElementWrapper()
@@ -221,16 +261,8 @@ QDomElement ElementWrapper::firstElementByTagNameNS(const QString &nsURI, const
         return QDomElement();
     }
 
-    for (QDomNode n = d->element.firstChild(); !n.isNull(); n = n.nextSibling()) {
-        if (n.isElement()) {
-            QDomElement e = n.toElement();
-            if (e.localName() == localName && e.namespaceURI() == nsURI) {
-                return e;
-            }
-        }
-    }
-
-    return QDomElement();
+    const QList<QDomElement> *elements = d->childElements(nsURI, localName);
+    return elements ? elements->first() : QDomElement();
 }
 
 QList<QDomElement> ElementWrapper::elementsByTagNameNS(const QString &nsURI, const QString &localName) const
@@ -239,16 +271,8 @@ QList<QDomElement> ElementWrapper::elementsByTagNameNS(const QString &nsURI, con
         return QList<QDomElement>();
     }
 
-    QList<QDomElement> elements;
-    for (QDomNode n = d->element.firstChild(); !n.isNull(); n = n.nextSibling()) {
-        if (n.isElement()) {
-            QDomElement e = n.toElement();
-            if (e.localName() == localName && e.namespaceURI() == nsURI) {
-                elements.append(e);
-            }
-        }
-    }
-    return elements;
+    const QList<QDomElement> *elements = d->childElements(nsURI, localName);
+    return elements ? *elements : QList<QDomElement>();
 }
 
 QString ElementWrapper::text() const
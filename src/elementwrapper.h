@@ -228,6 +228,10 @@ public:
      *
      * Returns a list of child elements with the given namespace URI
      * and tag name
+     *
+     * The children are indexed on the first call of this function or of
+     * firstElementByTagNameNS(), so child elements added to or removed from
+     * the wrapped element afterwards are not taken into account.
      */
     Q_REQUIRED_RESULT QList<QDomElement> elementsByTagNameNS(const QString &nsURI, const QString &tagName) const;
 
@@ -242,6 +246,8 @@ public:
      *
      * Returns the first child element with the given namespace URI and tag
      * name, or a null element if no such element was found.
+     *
+     * See elementsByTagNameNS() for how the children are looked up.
      */
     Q_REQUIRED_RESULT QDomElement firstElementByTagNameNS(const QString &nsURI, const QString &tagName) const;
 
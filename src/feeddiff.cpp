@@ -0,0 +1,355 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "feeddiff.h"
+#include "feeddiff_p.h"
+#include "feed.h"
+#include "item.h"
+#include "documentvisitor.h"
+#include "specificdocument.h"
+#include "specificitem.h"
+#include "specificitemvisitor.h"
+#include "tools.h"
+
+#include "atom/constants.h"
+#include "atom/document.h"
+#include "atom/entry.h"
+#include "mapper/itematomimpl.h"
+#include "mapper/itemrdfimpl.h"
+#include "mapper/itemrss2impl.h"
+#include "mapper/itemrss2streamimpl.h"
+#include "rdf/contentvocab.h"
+#include "rdf/document.h"
+#include "rdf/item.h"
+#include "rdf/resource.h"
+#include "rdf/rssvocab.h"
+#include "rss2/document.h"
+#include "rss2/item.h"
+#include "rss2/streamdocument.h"
+
+#include <QDomAttr>
+#include <QDomElement>
+#include <QDomNamedNodeMap>
+#include <QHash>
+
+namespace Syndication
+{
+namespace
+{
+bool isXmlWhitespace(QStringView text)
+{
+    for (const QChar c : text) {
+        if (c != QLatin1Char(' ') && c != QLatin1Char('\t') && c != QLatin1Char('\n') && c != QLatin1Char('\r')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// fingerprints format-specific items without going through the mapper
+class FingerprintVisitor : public SpecificItemVisitor
+{
+public:
+    ItemFingerprint fingerprint;
+
+    bool visitRSS2Item(Syndication::RSS2::Item *item) override
+    {
+        FingerprintBuilder builder;
+        builder.addElement(item->element());
+        fingerprint.content = builder.digest();
+
+        // the fields as read, like StreamReader::finishItem() does
+        fingerprint.identity =
+            identityDigest({item->guid(), item->extractElementTextNS(QString(), QStringLiteral("link")), item->originalTitle()}, fingerprint.content);
+        return true;
+    }
+
+    bool visitAtomEntry(Syndication::Atom::Entry *entry) override
+    {
+        FingerprintBuilder builder;
+        builder.addElement(entry->element());
+        fingerprint.content = builder.digest();
+
+        fingerprint.identity =
+            identityDigest({entry->id(), entry->extractElementTextNS(Atom::atom1Namespace(), QStringLiteral("title"))}, fingerprint.content);
+        return true;
+    }
+
+    bool visitRDFItem(Syndication::RDF::Item *item) override
+    {
+        // RDF items are statements of a model, there is no element to walk
+        const QString link = item->link();
+        const QString ns = RDF::RSSVocab::self()->namespaceURI();
+        FingerprintBuilder builder;
+        const auto addField = [&builder](const QString &namespaceURI, const QString &name, const QString &value) {
+            builder.startElement(namespaceURI, name);
+            builder.characters(value);
+            builder.endElement();
+        };
+        addField(ns, QStringLiteral("title"), item->originalTitle());
+        addField(ns, QStringLiteral("description"), item->originalDescription());
+        addField(ns, QStringLiteral("link"), link);
+        addField(RDF::ContentVocab::self()->namespaceURI(), QStringLiteral("encoded"), item->encodedContent());
+        fingerprint.content = builder.digest();
+
+        const RDF::ResourcePtr resource = item->resource();
+        fingerprint.identity = identityDigest({resource->isAnon() ? QString() : resource->uri(), link, item->originalTitle()}, fingerprint.content);
+        return true;
+    }
+};
+
+// collects the diff while going through the format-specific items of a
+// document, and maps only the items that are new or changed
+class DiffVisitor : public DocumentVisitor
+{
+public:
+    DiffVisitor(const QHash<quint64, quint64> &known, FeedDiff &diff)
+        : m_known(known)
+        , m_diff(diff)
+    {
+    }
+
+    bool visitRSS2Document(Syndication::RSS2::Document *document) override
+    {
+        const QList<RSS2::Item> items = document->items();
+        m_diff.fingerprints.reserve(items.size());
+        for (const RSS2::Item &i : items) {
+            RSS2::Item item(i);
+            FingerprintVisitor visitor;
+            visitor.visitRSS2Item(&item);
+            add(visitor.fingerprint, [&item]() {
+                return ItemPtr(new ItemRSS2Impl(item));
+            });
+        }
+        return true;
+    }
+
+    bool visitRDFDocument(Syndication::RDF::Document *document) override
+    {
+        const QList<RDF::Item> items = document->items();
+        m_diff.fingerprints.reserve(items.size());
+        for (const RDF::Item &i : items) {
+            RDF::Item item(i);
+            FingerprintVisitor visitor;
+            visitor.visitRDFItem(&item);
+            add(visitor.fingerprint, [&item]() {
+                return ItemPtr(new ItemRDFImpl(item));
+            });
+        }
+        return true;
+    }
+
+    bool visitAtomFeedDocument(Syndication::Atom::FeedDocument *document) override
+    {
+        const QList<Atom::Entry> entries = document->entries();
+        m_diff.fingerprints.reserve(entries.size());
+        for (const Atom::Entry &e : entries) {
+            Atom::Entry entry(e);
+            FingerprintVisitor visitor;
+            visitor.visitAtomEntry(&entry);
+            add(visitor.fingerprint, [&entry]() {
+                return ItemPtr(new ItemAtomImpl(entry));
+            });
+        }
+        return true;
+    }
+
+    void visitStreamDocument(const RSS2::StreamDocumentPtr &document)
+    {
+        const QList<RSS2::ItemRecord> &records = document->items();
+        m_diff.fingerprints.reserve(records.size());
+        for (int i = 0; i < records.size(); ++i) {
+            ItemFingerprint fingerprint;
+            fingerprint.identity = records.at(i).identity;
+            fingerprint.content = records.at(i).fingerprint;
+            add(fingerprint, [&document, i]() {
+                return ItemPtr(new ItemRSS2StreamImpl(document, i));
+            });
+        }
+    }
+
+    template<typename Map>
+    void add(const ItemFingerprint &fingerprint, Map map)
+    {
+        m_diff.fingerprints.append(fingerprint);
+
+        const auto it = m_known.constFind(fingerprint.identity);
+        if (it == m_known.cend()) {
+            m_diff.newItems.append(map());
+        } else if (it.value() != fingerprint.content) {
+            m_diff.changedItems.append(map());
+        }
+    }
+
+private:
+    const QHash<quint64, quint64> &m_known;
+    FeedDiff &m_diff;
+};
+
+} // namespace
+
+void FingerprintBuilder::startElement(QStringView namespaceURI, QStringView localName, QStringList attributes)
+{
+    m_data += QLatin1Char('<');
+    m_data += namespaceURI;
+    m_data += QLatin1Char('|');
+    m_data += localName;
+    attributes.sort();
+    for (const QString &attribute : std::as_const(attributes)) {
+        if (!attribute.isNull()) {
+            m_data += QLatin1Char(' ');
+            m_data += attribute;
+        }
+    }
+    m_data += QLatin1Char('>');
+}
+
+void FingerprintBuilder::characters(QStringView text)
+{
+    if (!isXmlWhitespace(text)) {
+        m_data += text;
+    }
+}
+
+void FingerprintBuilder::endElement()
+{
+    m_data += QLatin1String("</>");
+}
+
+void FingerprintBuilder::addElement(const QDomElement &element)
+{
+    QStringList attributes;
+    const QDomNamedNodeMap map = element.attributes();
+    const int count = map.length();
+    attributes.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const QDomAttr attr = map.item(i).toAttr();
+        const QString localName = attr.localName();
+        attributes.append(attribute(attr.namespaceURI(), localName.isNull() ? attr.name() : localName, attr.value()));
+    }
+
+    const QString localName = element.localName();
+    startElement(element.namespaceURI(), localName.isNull() ? element.tagName() : localName, attributes);
+
+    for (QDomNode child = element.firstChild(); !child.isNull(); child = child.nextSibling()) {
+        if (child.isElement()) {
+            addElement(child.toElement());
+        } else if (child.isText()) {
+            // includes CDATA sections
+            characters(child.toText().data());
+        }
+    }
+
+    endElement();
+}
+
+quint64 FingerprintBuilder::digest() const
+{
+    return calcDigest(m_data.toUtf8());
+}
+
+quint64 identityDigest(std::initializer_list<QString> keys, quint64 content)
+{
+    for (const QString &key : keys) {
+        if (!key.isEmpty()) {
+            return calcDigest(key.toUtf8());
+        }
+    }
+    return content;
+}
+
+QString FingerprintBuilder::attribute(QStringView namespaceURI, QStringView name, QStringView value)
+{
+    // the DOM may or may not keep namespace declarations as attributes
+    if (name == QLatin1String("xmlns") || name.startsWith(QLatin1String("xmlns:")) || namespaceURI == QLatin1String("http://www.w3.org/2000/xmlns/")) {
+        return QString();
+    }
+    QString result;
+    result.reserve(namespaceURI.size() + name.size() + value.size() + 2);
+    result += namespaceURI;
+    result += QLatin1Char('|');
+    result += name;
+    result += QLatin1Char('=');
+    result += value;
+    return result;
+}
+
+ItemFingerprint itemFingerprint(const ItemPtr &item)
+{
+    if (!item) {
+        return ItemFingerprint();
+    }
+
+    const SpecificItemPtr specific = item->specificItem();
+    if (specific) {
+        FingerprintVisitor visitor;
+        if (visitor.visit(specific.data())) {
+            return visitor.fingerprint;
+        }
+        if (const auto *streamItem = dynamic_cast<const RSS2::StreamItem *>(specific.data())) {
+            const RSS2::ItemRecord &record = streamItem->record();
+            ItemFingerprint fingerprint;
+            fingerprint.content = record.fingerprint;
+            fingerprint.identity = record.identity;
+            return fingerprint;
+        }
+    }
+
+    // items of custom formats only offer the mapped fields
+    FingerprintBuilder builder;
+    builder.characters(item->title());
+    builder.endElement();
+    builder.characters(item->description());
+    builder.endElement();
+    builder.characters(item->content());
+    builder.endElement();
+    builder.characters(item->link());
+    builder.endElement();
+    builder.characters(QString::number(item->dateUpdated()));
+    ItemFingerprint fingerprint;
+    fingerprint.content = builder.digest();
+    fingerprint.identity = identityDigest({item->id()}, fingerprint.content);
+    return fingerprint;
+}
+
+FeedDiff diffFeed(const FeedPtr &feed, const QList<ItemFingerprint> &previous)
+{
+    FeedDiff diff;
+    if (!feed) {
+        return diff;
+    }
+
+    QHash<quint64, quint64> known;
+    known.reserve(previous.size());
+    for (const ItemFingerprint &fingerprint : previous) {
+        known.insert(fingerprint.identity, fingerprint.content);
+    }
+
+    // go through the format-specific items, so unchanged items are not mapped
+    DiffVisitor visitor(known, diff);
+    const SpecificDocumentPtr document = feed->specificDocument();
+    if (const RSS2::StreamDocumentPtr stream = document.dynamicCast<RSS2::StreamDocument>()) {
+        visitor.visitStreamDocument(stream);
+        return diff;
+    }
+    if (document && visitor.visit(document.data())) {
+        return diff;
+    }
+
+    // other formats only offer the mapped items
+    const QList<ItemPtr> items = feed->items();
+    diff.fingerprints.reserve(items.size());
+    for (const ItemPtr &item : items) {
+        const ItemFingerprint fingerprint = itemFingerprint(item);
+        visitor.add(fingerprint, [&item]() {
+            return item;
+        });
+    }
+    return diff;
+}
+
+} // namespace Syndication
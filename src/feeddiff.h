@@ -0,0 +1,134 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_FEEDDIFF_H
+#define SYNDICATION_FEEDDIFF_H
+
+#include "syndication_export.h"
+
+#include <QList>
+#include <QSharedPointer>
+
+namespace Syndication
+{
+class Feed;
+typedef QSharedPointer<Feed> FeedPtr;
+class Item;
+typedef QSharedPointer<Item> ItemPtr;
+
+/*!
+ * \class Syndication::ItemFingerprint
+ * \inmodule Syndication
+ * \inheaderfile Syndication/FeedDiff
+ *
+ * \brief A compact summary of an item, to find out what changed between
+ * two fetches of a feed without comparing the items field by field.
+ *
+ * Fingerprints are plain values and can be stored between sessions, e.g.
+ * as the two numbers.
+ */
+struct ItemFingerprint {
+    /*!
+     * digest of what identifies the item: the guid (RSS 2), id (Atom) or
+     * URI (RDF), falling back to the link (RSS 2 and RDF) and then to the
+     * title, as given in the source. Items without any of these are
+     * identified by their content.
+     */
+    quint64 identity = 0;
+
+    /*!
+     * digest of the item's elements, attributes and text as read from the
+     * source, or of its title, description, link and encoded content for
+     * RDF items. For RSS 2 items, the streaming and the DOM parser produce
+     * the same digest.
+     */
+    quint64 content = 0;
+};
+
+/*!
+ * returns whether two fingerprints are equal
+ */
+inline bool operator==(const ItemFingerprint &lhs, const ItemFingerprint &rhs)
+{
+    return lhs.identity == rhs.identity && lhs.content == rhs.content;
+}
+
+/*!
+ * returns whether two fingerprints differ
+ */
+inline bool operator!=(const ItemFingerprint &lhs, const ItemFingerprint &rhs)
+{
+    return !(lhs == rhs);
+}
+
+/*!
+ * \class Syndication::FeedDiff
+ * \inmodule Syndication
+ * \inheaderfile Syndication/FeedDiff
+ *
+ * \brief The result of diffFeed(): the items that are new or changed since
+ * an earlier fetch.
+ */
+struct FeedDiff {
+    /*!
+     * items whose identity was not in the earlier fetch, in feed order
+     */
+    QList<ItemPtr> newItems;
+
+    /*!
+     * items known from the earlier fetch whose content changed, in feed
+     * order
+     */
+    QList<ItemPtr> changedItems;
+
+    /*!
+     * the fingerprints of all items of the feed, in feed order. Keep these
+     * to diff the next fetch against.
+     */
+    QList<ItemFingerprint> fingerprints;
+};
+
+/*!
+ * Returns the fingerprint of \a item.
+ *
+ * For items of the RSS 2, Atom and RDF formats, this reads the underlying
+ * format-specific item only and does not call the Item accessors, so
+ * nothing is normalized or converted. The streaming RSS 2 parser already
+ * calculates the digest while reading the item.
+ */
+SYNDICATION_EXPORT
+ItemFingerprint itemFingerprint(const ItemPtr &item);
+
+/*!
+ * Compares the items of \a feed against the fingerprints of an earlier
+ * fetch of the same feed and returns the items that are new or changed.
+ *
+ * For the RSS 2, Atom and RDF formats, the format-specific items of the
+ * feed's specific document are fingerprinted and only the new or changed
+ * ones are mapped, so with an aggregator that asks "what's new" after each
+ * fetch, most items never have their title, description or dates
+ * extracted. Items of other formats are all mapped.
+ *
+ * \code
+ * const FeedDiff diff = diffFeed(feed, storedFingerprints);
+ * for (const ItemPtr &item : diff.newItems) {
+ *     addArticle(item);
+ * }
+ * storedFingerprints = diff.fingerprints;
+ * \endcode
+ *
+ * \a feed the feed just fetched
+ *
+ * \a previous the fingerprints returned for the earlier fetch, empty on
+ * the first fetch
+ */
+SYNDICATION_EXPORT
+FeedDiff diffFeed(const FeedPtr &feed, const QList<ItemFingerprint> &previous);
+
+} // namespace Syndication
+
+#endif // SYNDICATION_FEEDDIFF_H
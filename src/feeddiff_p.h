@@ -0,0 +1,84 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_FEEDDIFF_P_H
+#define SYNDICATION_FEEDDIFF_P_H
+
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+#include <initializer_list>
+
+class QDomElement;
+
+namespace Syndication
+{
+//@cond PRIVATE
+/*!
+ * \internal
+ *
+ * Collects the elements, attributes and text of an item in a canonical
+ * form and calculates the content digest of ItemFingerprint from it.
+ *
+ * The form only depends on the XML infoset, not on how the item was read:
+ * attributes are sorted, namespace declarations, comments and
+ * whitespace-only text are left out. An item read with the streaming
+ * RSS 2 parser thus gets the same digest as one read into a DOM tree.
+ */
+class FingerprintBuilder
+{
+public:
+    /*!
+     * adds a start tag
+     *
+     * \a attributes the attributes, as created by attribute(), in any order
+     */
+    void startElement(QStringView namespaceURI, QStringView localName, QStringList attributes = QStringList());
+
+    /*!
+     * adds text or CDATA content. Whitespace-only text is ignored.
+     */
+    void characters(QStringView text);
+
+    /*!
+     * adds an end tag
+     */
+    void endElement();
+
+    /*!
+     * adds \a element and all its descendants
+     */
+    void addElement(const QDomElement &element);
+
+    /*!
+     * the digest of everything added so far
+     */
+    quint64 digest() const;
+
+    /*!
+     * returns an attribute in the form startElement() expects, or a null
+     * string for namespace declarations
+     */
+    static QString attribute(QStringView namespaceURI, QStringView name, QStringView value);
+
+private:
+    QString m_data;
+};
+
+/*!
+ * \internal
+ *
+ * returns the identity digest of ItemFingerprint: the digest of the first
+ * non-empty key, or \a content if all keys are empty
+ */
+quint64 identityDigest(std::initializer_list<QString> keys, quint64 content);
+//@endcond
+
+} // namespace Syndication
+
+#endif // SYNDICATION_FEEDDIFF_P_H
@@ -0,0 +1,492 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "feedsnapshot.h"
+#include "category.h"
+#include "enclosure.h"
+#include "feed.h"
+#include "feedsnapshot_p.h"
+#include "image.h"
+#include "item.h"
+#include "person.h"
+
+#include "mapper/feedsnapshotimpl.h"
+
+#include <QDomDocument>
+#include <QHash>
+#include <QSaveFile>
+#include <QTextStream>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace Syndication
+{
+namespace
+{
+// fills the string pool of a snapshot, storing equal strings only once
+class StringPoolBuilder
+{
+public:
+    StringPoolBuilder(QString &chars, QList<quint32> &offsets)
+        : m_chars(chars)
+        , m_offsets(offsets)
+    {
+        // string 0 is the null string
+        m_offsets = {0, 0};
+    }
+
+    Snapshot::StringId add(const QString &string)
+    {
+        if (string.isNull()) {
+            return 0;
+        }
+
+        const auto it = m_ids.constFind(string);
+        if (it != m_ids.constEnd()) {
+            return it.value();
+        }
+
+        const Snapshot::StringId id = m_offsets.size() - 1;
+        m_chars.append(string);
+        m_offsets.append(m_chars.size());
+        m_ids.insert(string, id);
+        return id;
+    }
+
+private:
+    QString &m_chars;
+    QList<quint32> &m_offsets;
+    QHash<QString, Snapshot::StringId> m_ids;
+};
+
+QString toXml(const QDomElement &element)
+{
+    QString xml;
+    QTextStream stream(&xml);
+    element.save(stream, -1);
+    stream.flush();
+    return xml;
+}
+
+template<typename T>
+Snapshot::Array<T> arrayOf(const QList<T> &list)
+{
+    Snapshot::Array<T> array;
+    array.data = list.constData();
+    array.size = list.size();
+    return array;
+}
+
+// The binary format is a FileHeader followed by one section for each
+// record array and the string pool, each starting at a multiple of
+// sectionAlignment. The records are stored as they are laid out in
+// memory, so they can be used right from a memory mapped file. Files are
+// written in the byte order of the host and only read on hosts with the
+// same byte order. Any change of the records needs a new fileVersion.
+const char fileMagic[8] = {'K', 'S', 'Y', 'N', 'S', 'N', 'A', 'P'};
+const quint32 fileVersion = 1;
+const quint32 byteOrderMark = 0x01020304;
+const qsizetype sectionAlignment = 8;
+
+enum Section {
+    ChannelSection,
+    ItemSection,
+    PersonSection,
+    CategorySection,
+    EnclosureSection,
+    PropertySection,
+    StringOffsetSection,
+    CharSection,
+    SectionCount,
+};
+
+struct FileSection {
+    quint64 offset;
+    quint64 count; // in records
+};
+
+struct FileHeader {
+    char magic[8];
+    quint32 version;
+    quint32 byteOrder;
+    FileSection sections[SectionCount];
+};
+
+static_assert(sizeof(FileHeader) == 144, "the header layout is part of the file format");
+static_assert(sizeof(Snapshot::Channel) == 100, "the record layout is part of the file format");
+static_assert(sizeof(Snapshot::Item) == 88, "the record layout is part of the file format");
+static_assert(sizeof(Snapshot::Person) == 12, "the record layout is part of the file format");
+static_assert(sizeof(Snapshot::Category) == 12, "the record layout is part of the file format");
+static_assert(sizeof(Snapshot::Enclosure) == 20, "the record layout is part of the file format");
+static_assert(sizeof(Snapshot::Property) == 8, "the record layout is part of the file format");
+static_assert(alignof(FileHeader) <= sectionAlignment, "sections must be aligned for all records");
+
+template<typename T>
+bool readSection(const char *data, qint64 size, const FileSection &section, Snapshot::Array<T> &array)
+{
+    if (section.offset % alignof(T) != 0 || section.offset > quint64(size)) {
+        return false;
+    }
+    if (section.count > (quint64(size) - section.offset) / sizeof(T) || section.count > std::numeric_limits<quint32>::max()) {
+        return false;
+    }
+
+    array.data = reinterpret_cast<const T *>(data + section.offset);
+    array.size = quint32(section.count);
+    return true;
+}
+
+} // namespace
+
+FeedSnapshotPrivate::FeedSnapshotPrivate(const FeedPtr &feed)
+{
+    StringPoolBuilder pool(m_chars, m_stringOffsets);
+
+    const auto addImage = [&pool](const ImagePtr &image) {
+        Snapshot::Image record;
+        if (image && !image->isNull()) {
+            record.url = pool.add(image->url());
+            record.title = pool.add(image->title());
+            record.link = pool.add(image->link());
+            record.description = pool.add(image->description());
+            record.width = image->width();
+            record.height = image->height();
+            record.isNull = 0;
+        }
+        return record;
+    };
+
+    const auto addPersons = [this, &pool](const QList<PersonPtr> &list) {
+        const Snapshot::Range range{quint32(m_persons.size()), quint32(list.size())};
+        for (const PersonPtr &person : list) {
+            m_persons.append(Snapshot::Person{pool.add(person->name()), pool.add(person->uri()), pool.add(person->email())});
+        }
+        return range;
+    };
+
+    const auto addCategories = [this, &pool](const QList<CategoryPtr> &list) {
+        const Snapshot::Range range{quint32(m_categories.size()), quint32(list.size())};
+        for (const CategoryPtr &category : list) {
+            m_categories.append(Snapshot::Category{pool.add(category->term()), pool.add(category->scheme()), pool.add(category->label())});
+        }
+        return range;
+    };
+
+    const auto addEnclosures = [this, &pool](const QList<EnclosurePtr> &list) {
+        const Snapshot::Range range{quint32(m_enclosures.size()), quint32(list.size())};
+        for (const EnclosurePtr &enclosure : list) {
+            m_enclosures.append(
+                Snapshot::Enclosure{pool.add(enclosure->url()), pool.add(enclosure->title()), pool.add(enclosure->type()), enclosure->length(), enclosure->duration()});
+        }
+        return range;
+    };
+
+    const auto addProperties = [this, &pool](const QMultiMap<QString, QDomElement> &map) {
+        const Snapshot::Range range{quint32(m_properties.size()), quint32(map.size())};
+        for (auto it = map.cbegin(); it != map.cend(); ++it) {
+            m_properties.append(Snapshot::Property{pool.add(it.key()), pool.add(toXml(it.value()))});
+        }
+        return range;
+    };
+
+    m_channel.title = pool.add(feed->title());
+    m_channel.link = pool.add(feed->link());
+    m_channel.description = pool.add(feed->description());
+    m_channel.language = pool.add(feed->language());
+    m_channel.copyright = pool.add(feed->copyright());
+    m_channel.image = addImage(feed->image());
+    m_channel.icon = addImage(feed->icon());
+    m_channel.authors = addPersons(feed->authors());
+    m_channel.categories = addCategories(feed->categories());
+    m_channel.properties = addProperties(feed->additionalProperties());
+
+    const QList<ItemPtr> feedItems = feed->items();
+    m_items.reserve(feedItems.size());
+    for (const ItemPtr &item : feedItems) {
+        Snapshot::Item record;
+        record.title = pool.add(item->title());
+        record.link = pool.add(item->link());
+        record.description = pool.add(item->description());
+        record.content = pool.add(item->content());
+        record.id = pool.add(item->id());
+        record.language = pool.add(item->language());
+        record.commentsLink = pool.add(item->commentsLink());
+        record.commentsFeed = pool.add(item->commentsFeed());
+        record.commentPostUri = pool.add(item->commentPostUri());
+        record.commentsCount = item->commentsCount();
+        record.datePublished = item->datePublished();
+        record.dateUpdated = item->dateUpdated();
+        record.authors = addPersons(item->authors());
+        record.enclosures = addEnclosures(item->enclosures());
+        record.categories = addCategories(item->categories());
+        record.properties = addProperties(item->additionalProperties());
+        m_items.append(record);
+    }
+
+    m_persons.squeeze();
+    m_categories.squeeze();
+    m_enclosures.squeeze();
+    m_properties.squeeze();
+    m_stringOffsets.squeeze();
+    m_chars.squeeze();
+
+    channel = &m_channel;
+    items = arrayOf(m_items);
+    persons = arrayOf(m_persons);
+    categories = arrayOf(m_categories);
+    enclosures = arrayOf(m_enclosures);
+    properties = arrayOf(m_properties);
+    stringOffsets = arrayOf(m_stringOffsets);
+    chars.data = reinterpret_cast<const char16_t *>(m_chars.utf16());
+    chars.size = m_chars.size();
+}
+
+FeedSnapshotPrivate::FeedSnapshotPrivate()
+{
+}
+
+FeedSnapshotPrivate::~FeedSnapshotPrivate()
+{
+}
+
+FeedSnapshotPrivatePtr FeedSnapshotPrivate::fromByteArray(const QByteArray &data)
+{
+    QSharedPointer<FeedSnapshotPrivate> snapshot(new FeedSnapshotPrivate);
+    snapshot->m_data = data;
+    const char *begin = data.constData();
+
+    if (quintptr(begin) % alignof(FileHeader) != 0) {
+        // the records are read in place, which needs aligned data
+        QByteArray aligned(data.size() + alignof(FileHeader), Qt::Uninitialized);
+        const qsizetype offset = (alignof(FileHeader) - quintptr(aligned.constData()) % alignof(FileHeader)) % alignof(FileHeader);
+        std::memcpy(aligned.data() + offset, data.constData(), data.size());
+        snapshot->m_data = aligned;
+        begin = snapshot->m_data.constData() + offset;
+    }
+
+    if (!snapshot->attach(begin, data.size())) {
+        return FeedSnapshotPrivatePtr();
+    }
+    return snapshot;
+}
+
+FeedSnapshotPrivatePtr FeedSnapshotPrivate::fromFile(const QString &fileName)
+{
+    auto file = std::make_unique<QFile>(fileName);
+    if (!file->open(QIODevice::ReadOnly)) {
+        return FeedSnapshotPrivatePtr();
+    }
+
+    const qint64 size = file->size();
+    const uchar *data = size > 0 ? file->map(0, size) : nullptr;
+    if (!data) {
+        // not every file can be mapped, read these instead
+        return fromByteArray(file->readAll());
+    }
+
+    QSharedPointer<FeedSnapshotPrivate> snapshot(new FeedSnapshotPrivate);
+    if (!snapshot->attach(reinterpret_cast<const char *>(data), size)) {
+        return FeedSnapshotPrivatePtr();
+    }
+    snapshot->m_file = std::move(file);
+    return snapshot;
+}
+
+bool FeedSnapshotPrivate::attach(const char *data, qint64 size)
+{
+    if (size < qint64(sizeof(FileHeader)) || quintptr(data) % alignof(FileHeader) != 0) {
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0 || header.version != fileVersion || header.byteOrder != byteOrderMark) {
+        return false;
+    }
+
+    Snapshot::Array<Snapshot::Channel> channels;
+    if (!readSection(data, size, header.sections[ChannelSection], channels) || channels.size != 1) {
+        return false;
+    }
+    channel = channels.data;
+
+    // the string offsets start with the null string
+    return readSection(data, size, header.sections[ItemSection], items) && readSection(data, size, header.sections[PersonSection], persons)
+        && readSection(data, size, header.sections[CategorySection], categories) && readSection(data, size, header.sections[EnclosureSection], enclosures)
+        && readSection(data, size, header.sections[PropertySection], properties)
+        && readSection(data, size, header.sections[StringOffsetSection], stringOffsets) && stringOffsets.size >= 2
+        && readSection(data, size, header.sections[CharSection], chars);
+}
+
+QByteArray FeedSnapshotPrivate::toByteArray() const
+{
+    FileHeader header = {};
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = fileVersion;
+    header.byteOrder = byteOrderMark;
+
+    QByteArray data(qsizetype(sizeof(FileHeader)), '\0');
+    data.reserve(qsizetype(sizeof(FileHeader)) + size() + SectionCount * sectionAlignment);
+
+    const auto appendSection = [&data, &header](Section section, const void *records, quint32 count, size_t recordSize) {
+        data.append((sectionAlignment - data.size() % sectionAlignment) % sectionAlignment, '\0');
+        header.sections[section].offset = data.size();
+        header.sections[section].count = count;
+        if (count > 0) {
+            data.append(static_cast<const char *>(records), qsizetype(count * recordSize));
+        }
+    };
+
+    appendSection(ChannelSection, channel, 1, sizeof(Snapshot::Channel));
+    appendSection(ItemSection, items.data, items.size, sizeof(Snapshot::Item));
+    appendSection(PersonSection, persons.data, persons.size, sizeof(Snapshot::Person));
+    appendSection(CategorySection, categories.data, categories.size, sizeof(Snapshot::Category));
+    appendSection(EnclosureSection, enclosures.data, enclosures.size, sizeof(Snapshot::Enclosure));
+    appendSection(PropertySection, properties.data, properties.size, sizeof(Snapshot::Property));
+    appendSection(StringOffsetSection, stringOffsets.data, stringOffsets.size, sizeof(quint32));
+    appendSection(CharSection, chars.data, chars.size, sizeof(char16_t));
+
+    std::memcpy(data.data(), &header, sizeof(header));
+    return data;
+}
+
+QString FeedSnapshotPrivate::string(Snapshot::StringId id) const
+{
+    if (id == 0 || quint64(id) + 1 >= stringOffsets.size) {
+        return QString();
+    }
+
+    const quint32 begin = stringOffsets[id];
+    const quint32 end = stringOffsets[id + 1];
+    if (begin > end || end > chars.size) {
+        return QString();
+    }
+    if (begin == end) {
+        return QStringLiteral("");
+    }
+    return QString(reinterpret_cast<const QChar *>(chars.data + begin), end - begin);
+}
+
+QMultiMap<QString, QDomElement> FeedSnapshotPrivate::elements(Snapshot::Range range) const
+{
+    QMultiMap<QString, QDomElement> ret;
+
+    // QMultiMap puts the values inserted last first, so insert backwards
+    // to keep the order of values with the same key
+    range = bounded(range, properties.size);
+    for (quint32 i = range.first + range.count; i > range.first; --i) {
+        const Snapshot::Property &property = properties[i - 1];
+        QDomDocument doc;
+        if (doc.setContent(string(property.xml), QDomDocument::ParseOption::UseNamespaceProcessing)) {
+            ret.insert(string(property.key), doc.documentElement());
+        }
+    }
+
+    return ret;
+}
+
+Snapshot::Range FeedSnapshotPrivate::bounded(Snapshot::Range range, quint32 size)
+{
+    if (range.first >= size) {
+        return Snapshot::Range();
+    }
+    range.count = std::min(range.count, size - range.first);
+    return range;
+}
+
+qint64 FeedSnapshotPrivate::size() const
+{
+    return qint64(sizeof(Snapshot::Channel)) + qint64(items.size) * sizeof(Snapshot::Item) + qint64(persons.size) * sizeof(Snapshot::Person)
+        + qint64(categories.size) * sizeof(Snapshot::Category) + qint64(enclosures.size) * sizeof(Snapshot::Enclosure)
+        + qint64(properties.size) * sizeof(Snapshot::Property) + qint64(stringOffsets.size) * sizeof(quint32) + qint64(chars.size) * sizeof(char16_t);
+}
+
+FeedSnapshot::FeedSnapshot()
+{
+}
+
+FeedSnapshot::FeedSnapshot(const FeedPtr &feed)
+{
+    if (feed) {
+        d.reset(new FeedSnapshotPrivate(feed));
+    }
+}
+
+FeedSnapshot::FeedSnapshot(const FeedSnapshot &other)
+    : d(other.d)
+{
+}
+
+FeedSnapshot::~FeedSnapshot()
+{
+}
+
+FeedSnapshot &FeedSnapshot::operator=(const FeedSnapshot &other)
+{
+    d = other.d;
+    return *this;
+}
+
+bool FeedSnapshot::isNull() const
+{
+    return !d;
+}
+
+FeedPtr FeedSnapshot::feed() const
+{
+    if (!d) {
+        return FeedPtr();
+    }
+    return FeedSnapshotImplPtr(new FeedSnapshotImpl(d));
+}
+
+int FeedSnapshot::itemCount() const
+{
+    return d ? int(d->items.size) : 0;
+}
+
+qint64 FeedSnapshot::size() const
+{
+    return d ? d->size() : 0;
+}
+
+QByteArray FeedSnapshot::toByteArray() const
+{
+    return d ? d->toByteArray() : QByteArray();
+}
+
+FeedSnapshot FeedSnapshot::fromByteArray(const QByteArray &data)
+{
+    FeedSnapshot snapshot;
+    snapshot.d = FeedSnapshotPrivate::fromByteArray(data);
+    return snapshot;
+}
+
+bool FeedSnapshot::save(const QString &fileName) const
+{
+    if (!d) {
+        return false;
+    }
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(d->toByteArray());
+    return file.commit();
+}
+
+FeedSnapshot FeedSnapshot::load(const QString &fileName)
+{
+    FeedSnapshot snapshot;
+    snapshot.d = FeedSnapshotPrivate::fromFile(fileName);
+    return snapshot;
+}
+
+} // namespace Syndication
@@ -0,0 +1,167 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_FEEDSNAPSHOT_H
+#define SYNDICATION_FEEDSNAPSHOT_H
+
+#include "syndication_export.h"
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QString>
+
+namespace Syndication
+{
+class Feed;
+typedef QSharedPointer<Feed> FeedPtr;
+class FeedSnapshotPrivate;
+
+/*!
+ * \class Syndication::FeedSnapshot
+ * \inmodule Syndication
+ * \inheaderfile Syndication/FeedSnapshot
+ *
+ * \brief An immutable, compact copy of a Feed.
+ *
+ * Feeds parsed from a DOM keep the whole DOM document alive as long as
+ * any of their items is referenced, which takes many times the size of
+ * the raw document. A snapshot copies all fields of the feed, its items,
+ * enclosures, categories, persons and additional properties into a few
+ * contiguous arrays sharing one string pool, with equal strings stored
+ * only once. The original feed and its DOM can be released afterwards.
+ *
+ * \code
+ * FeedSnapshot snapshot(Syndication::parse(source));
+ * // the DOM is gone, the snapshot is all that is left
+ * const FeedPtr feed = snapshot.feed();
+ * \endcode
+ *
+ * The additional properties are kept as serialized XML and turned into
+ * DOM elements again when asked for. The format-specific document and
+ * items are not kept: specificDocument() and specificItem() of the
+ * snapshot feed return null pointers.
+ *
+ * Snapshots can be stored in a compact binary format with save() or
+ * toByteArray(), e.g. to cache parsed feeds across restarts instead of
+ * parsing their XML again. load() maps such a file into memory and reads
+ * the records right from the mapping, strings are only decoded when they
+ * are asked for. Callers get the same Feed either way:
+ *
+ * \code
+ * FeedSnapshot snapshot = FeedSnapshot::load(cacheFile);
+ * if (snapshot.isNull()) {
+ *     snapshot = FeedSnapshot(Syndication::parse(source));
+ *     snapshot.save(cacheFile);
+ * }
+ * const FeedPtr feed = snapshot.feed();
+ * \endcode
+ *
+ * The binary format is versioned. Files of other versions, or written on
+ * a host with a different byte order, are not loaded, so they are
+ * treated like a cache miss.
+ *
+ * Snapshots are implicitly shared and can be read from several threads.
+ */
+class SYNDICATION_EXPORT FeedSnapshot
+{
+public:
+    /*!
+     * Creates a null snapshot.
+     */
+    FeedSnapshot();
+
+    /*!
+     * Takes a snapshot of \a feed. The snapshot is null if \a feed is.
+     */
+    explicit FeedSnapshot(const FeedPtr &feed);
+
+    /*!
+     * Copy constructor. The data is shared, so this is a cheap operation.
+     *
+     * \a other FeedSnapshot to copy
+     */
+    FeedSnapshot(const FeedSnapshot &other);
+
+    ~FeedSnapshot();
+
+    /*!
+     * Assignment operator. The data is shared, so this is a cheap
+     * operation.
+     *
+     * \a other FeedSnapshot to assign to this instance
+     *
+     * Returns reference to this instance
+     */
+    FeedSnapshot &operator=(const FeedSnapshot &other);
+
+    /*!
+     * returns whether this snapshot is null, i.e. was created by the
+     * default constructor or from a null feed
+     */
+    Q_REQUIRED_RESULT bool isNull() const;
+
+    /*!
+     * Returns the snapshot as Feed, with the same fields as the feed it
+     * was taken from. The returned feed and its items keep the snapshot
+     * data alive, nothing else. Returns a null pointer for a null
+     * snapshot.
+     */
+    Q_REQUIRED_RESULT FeedPtr feed() const;
+
+    /*!
+     * returns the number of items of the feed
+     */
+    Q_REQUIRED_RESULT int itemCount() const;
+
+    /*!
+     * returns the number of bytes taken by the snapshot data, to account
+     * for the memory used by a cache of snapshots
+     */
+    Q_REQUIRED_RESULT qint64 size() const;
+
+    /*!
+     * Returns the snapshot in the binary format, or an empty array for a
+     * null snapshot.
+     */
+    Q_REQUIRED_RESULT QByteArray toByteArray() const;
+
+    /*!
+     * Reads a snapshot in the binary format from \a data. The snapshot
+     * shares the array and reads the records from it.
+     *
+     * Returns the snapshot, or a null snapshot if \a data is not a
+     * snapshot of the current format version
+     */
+    Q_REQUIRED_RESULT static FeedSnapshot fromByteArray(const QByteArray &data);
+
+    /*!
+     * Writes the snapshot in the binary format to the file \a fileName.
+     * The file is replaced at once when the snapshot is written
+     * completely, so it is never left half written.
+     *
+     * Returns whether the file was written; a null snapshot is never
+     * written
+     */
+    bool save(const QString &fileName) const;
+
+    /*!
+     * Reads a snapshot in the binary format from the file \a fileName. The
+     * file is mapped into memory and stays mapped as long as the snapshot,
+     * or a feed or item returned for it, exists.
+     *
+     * Returns the snapshot, or a null snapshot if the file cannot be read
+     * or is not a snapshot of the current format version
+     */
+    Q_REQUIRED_RESULT static FeedSnapshot load(const QString &fileName);
+
+private:
+    QSharedPointer<const FeedSnapshotPrivate> d;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_FEEDSNAPSHOT_H
@@ -0,0 +1,253 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_FEEDSNAPSHOT_P_H
+#define SYNDICATION_FEEDSNAPSHOT_P_H
+
+#include "feed.h"
+
+#include <QByteArray>
+#include <QDomElement>
+#include <QFile>
+#include <QList>
+#include <QMultiMap>
+#include <QString>
+
+#include <memory>
+
+namespace Syndication
+{
+//@cond PRIVATE
+namespace Snapshot
+{
+/*!
+ * \internal
+ * index of a string in the string pool, 0 is the null string
+ */
+typedef quint32 StringId;
+
+/*!
+ * \internal
+ * a slice of one of the record arrays
+ */
+struct Range {
+    quint32 first = 0;
+    quint32 count = 0;
+};
+
+/*!
+ * \internal
+ */
+struct Person {
+    StringId name = 0;
+    StringId uri = 0;
+    StringId email = 0;
+};
+
+/*!
+ * \internal
+ */
+struct Category {
+    StringId term = 0;
+    StringId scheme = 0;
+    StringId label = 0;
+};
+
+/*!
+ * \internal
+ */
+struct Enclosure {
+    StringId url = 0;
+    StringId title = 0;
+    StringId type = 0;
+    quint32 length = 0;
+    quint32 duration = 0;
+};
+
+/*!
+ * \internal
+ * an additional property, the element is kept as serialized XML
+ */
+struct Property {
+    StringId key = 0;
+    StringId xml = 0;
+};
+
+/*!
+ * \internal
+ */
+struct Image {
+    StringId url = 0;
+    StringId title = 0;
+    StringId link = 0;
+    StringId description = 0;
+    quint32 width = 0;
+    quint32 height = 0;
+    quint32 isNull = 1;
+};
+
+/*!
+ * \internal
+ * the fields of an item, with slices of the person, enclosure, category
+ * and property arrays
+ */
+struct Item {
+    StringId title = 0;
+    StringId link = 0;
+    StringId description = 0;
+    StringId content = 0;
+    StringId id = 0;
+    StringId language = 0;
+    StringId commentsLink = 0;
+    StringId commentsFeed = 0;
+    StringId commentPostUri = 0;
+    qint32 commentsCount = -1;
+    qint64 datePublished = 0;
+    qint64 dateUpdated = 0;
+    Range authors;
+    Range enclosures;
+    Range categories;
+    Range properties;
+};
+
+/*!
+ * \internal
+ * the fields of the feed itself
+ */
+struct Channel {
+    StringId title = 0;
+    StringId link = 0;
+    StringId description = 0;
+    StringId language = 0;
+    StringId copyright = 0;
+    Image image;
+    Image icon;
+    Range authors;
+    Range categories;
+    Range properties;
+};
+
+/*!
+ * \internal
+ * read-only view on a contiguous array of records
+ */
+template<typename T>
+struct Array {
+    const T *data = nullptr;
+    quint32 size = 0;
+
+    const T &operator[](quint32 index) const
+    {
+        return data[index];
+    }
+};
+
+} // namespace Snapshot
+
+/*!
+ * \internal
+ * The data of a FeedSnapshot. All accessors work on the views (channel,
+ * the record arrays and the string pool), so the data can live in the
+ * containers below, for snapshots taken from a Feed, or in a byte array or
+ * memory mapped file in the binary format. The data is never changed after
+ * construction.
+ */
+class FeedSnapshotPrivate
+{
+public:
+    /*!
+     * takes a snapshot of \a feed, which must not be null
+     */
+    explicit FeedSnapshotPrivate(const FeedPtr &feed);
+
+    FeedSnapshotPrivate(const FeedSnapshotPrivate &) = delete;
+    FeedSnapshotPrivate &operator=(const FeedSnapshotPrivate &) = delete;
+
+    ~FeedSnapshotPrivate();
+
+    /*!
+     * reads a snapshot in the binary format from \a data, sharing the
+     * array. Returns a null pointer if \a data is not a valid snapshot.
+     */
+    static QSharedPointer<const FeedSnapshotPrivate> fromByteArray(const QByteArray &data);
+
+    /*!
+     * Maps the file \a fileName into memory and reads the snapshot in the
+     * binary format from it. Returns a null pointer if the file cannot be
+     * read or is not a valid snapshot.
+     */
+    static QSharedPointer<const FeedSnapshotPrivate> fromFile(const QString &fileName);
+
+    /*!
+     * returns the snapshot in the binary format
+     */
+    QByteArray toByteArray() const;
+
+    /*!
+     * returns string \a id from the string pool. Strings are only
+     * decoded when asked for.
+     */
+    QString string(Snapshot::StringId id) const;
+
+    /*!
+     * returns the elements of the properties in \a range
+     */
+    QMultiMap<QString, QDomElement> elements(Snapshot::Range range) const;
+
+    /*!
+     * returns the number of bytes taken by the records and the string pool
+     */
+    qint64 size() const;
+
+    /*!
+     * returns the part of \a range that lies within an array of \a size
+     * records. Ranges are not checked when reading files, to keep loading
+     * cheap, so they are checked when used.
+     */
+    static Snapshot::Range bounded(Snapshot::Range range, quint32 size);
+
+    const Snapshot::Channel *channel = nullptr;
+    Snapshot::Array<Snapshot::Item> items;
+    Snapshot::Array<Snapshot::Person> persons;
+    Snapshot::Array<Snapshot::Category> categories;
+    Snapshot::Array<Snapshot::Enclosure> enclosures;
+    Snapshot::Array<Snapshot::Property> properties;
+
+    // string i consists of the UTF-16 code units from stringOffsets[i] to
+    // stringOffsets[i + 1] of chars
+    Snapshot::Array<quint32> stringOffsets;
+    Snapshot::Array<char16_t> chars;
+
+private:
+    FeedSnapshotPrivate();
+
+    // sets the views to the binary format in the size bytes at data,
+    // returns false if they do not hold a valid snapshot
+    bool attach(const char *data, qint64 size);
+
+    // storage of snapshots taken from a feed
+    Snapshot::Channel m_channel;
+    QList<Snapshot::Item> m_items;
+    QList<Snapshot::Person> m_persons;
+    QList<Snapshot::Category> m_categories;
+    QList<Snapshot::Enclosure> m_enclosures;
+    QList<Snapshot::Property> m_properties;
+    QList<quint32> m_stringOffsets;
+    QString m_chars;
+
+    // storage of snapshots in the binary format
+    QByteArray m_data;
+    std::unique_ptr<QFile> m_file;
+};
+
+typedef QSharedPointer<const FeedSnapshotPrivate> FeedSnapshotPrivatePtr;
+
+//@endcond
+
+} // namespace Syndication
+
+#endif // SYNDICATION_FEEDSNAPSHOT_P_H
@@ -10,18 +10,27 @@
 #include "parsercollectionimpl.h"
 
 #include "atom/parser.h"
+#include "atom/streamparser.h"
 #include "mapper/mapperatomimpl.h"
 #include "mapper/mapperrdfimpl.h"
 #include "mapper/mapperrss2impl.h"
+#include "mapper/mapperrss2streamimpl.h"
 #include "rdf/parser.h"
 #include "rss2/parser.h"
+#include "rss2/streamparser.h"
 
+#include <QCache>
 #include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QThreadPool>
 
-namespace
-{
-static bool collectionIsInitialized = false;
-}
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 namespace Syndication
 {
@@ -36,24 +45,198 @@ static void cleanupParserCollection()
     parserColl = nullptr;
 }
 
-} // namespace
-
-ParserCollection<Feed> *parserCollection()
+static ParserCollectionImpl<Syndication::Feed> *defaultParserCollection()
 {
-    if (!collectionIsInitialized) {
+    // created exactly once, also when first called from several threads
+    static const bool created = [] {
         parserColl = new ParserCollectionImpl<Syndication::Feed>;
         qAddPostRoutine(cleanupParserCollection);
         parserColl->registerParser(new RSS2::Parser, new RSS2Mapper);
         parserColl->registerParser(new Atom::Parser, new AtomMapper);
         parserColl->registerParser(new RDF::Parser, new RDFMapper);
-        collectionIsInitialized = true;
-    }
+        // only used when asked for via the "rss2stream" and "atomstream" format
+        // hints, the DOM parsers accept these formats first
+        parserColl->registerParser(new RSS2::StreamParser, new RSS2StreamMapper);
+        parserColl->registerParser(new Atom::StreamParser, new AtomMapper);
+        return true;
+    }();
+    Q_UNUSED(created)
     return parserColl;
 }
 
+// identifies documents parsed before by their content
+struct ParseCacheKey {
+    quint64 digest = 0;
+    qsizetype size = 0;
+    QString formatHint;
+
+    bool operator==(const ParseCacheKey &other) const
+    {
+        return digest == other.digest && size == other.size && formatHint == other.formatHint;
+    }
+};
+
+size_t qHash(const ParseCacheKey &key, size_t seed = 0)
+{
+    return qHashMulti(seed, key.digest, key.size, key.formatHint);
+}
+
+struct ParseCache {
+    QMutex mutex;
+    QCache<ParseCacheKey, ParseResult> results{0};
+};
+
+Q_GLOBAL_STATIC(ParseCache, parseCache)
+
+// shared state of one parseBatch() call
+struct BatchState {
+    const QList<DocumentSource> &sources;
+    const QString &formatHint;
+    std::atomic<int> next{0};
+    std::vector<ParseResult> results;
+    std::vector<qint64> nanoseconds;
+    QSemaphore finished;
+
+    BatchState(const QList<DocumentSource> &s, const QString &hint)
+        : sources(s)
+        , formatHint(hint)
+        , results(s.size())
+        , nanoseconds(s.size(), 0)
+    {
+    }
+
+    // parses sources until none are left. Every index is handed out exactly
+    // once, so the slots written here are never touched by other threads.
+    void work()
+    {
+        QElapsedTimer timer;
+        for (int i = next++; i < sources.size(); i = next++) {
+            timer.start();
+            results[i] = parseDocument(sources.at(i), formatHint);
+            nanoseconds[i] = timer.nsecsElapsed();
+        }
+    }
+};
+
+class BatchWorker : public QRunnable
+{
+public:
+    explicit BatchWorker(BatchState *state)
+        : m_state(state)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() override
+    {
+        m_state->work();
+        m_state->finished.release();
+    }
+
+private:
+    BatchState *const m_state;
+};
+
+} // namespace
+
+ParserCollection<Feed> *parserCollection()
+{
+    return defaultParserCollection();
+}
+
 FeedPtr parse(const DocumentSource &src, const QString &formatHint)
 {
     return parserCollection()->parse(src, formatHint);
 }
 
+ParseResult parseDocument(const DocumentSource &src, const QString &formatHint)
+{
+    ParseResult result;
+    const ParserCollectionImpl<Syndication::Feed> *collection = defaultParserCollection();
+    if (!collection) {
+        // the application is shutting down
+        result.error = Aborted;
+        return result;
+    }
+
+    // a private copy, so the DOM tree built while parsing is not cached in a
+    // DocumentSource other threads might use as well
+    const DocumentSource source(src.asByteArray(), src.url());
+
+    ParseCache *cache = parseCache();
+    const bool cached = cache && parseCacheCapacity() > 0;
+    ParseCacheKey key;
+    if (cached) {
+        key = {source.digest(), source.asByteArray().size(), formatHint};
+        QMutexLocker locker(&cache->mutex);
+        if (const ParseResult *earlier = cache->results.object(key)) {
+            return *earlier;
+        }
+    }
+
+    result.feed = collection->parse(source, formatHint, &result.error, &result.format);
+
+    if (cached) {
+        QMutexLocker locker(&cache->mutex);
+        cache->results.insert(key, new ParseResult(result));
+    }
+    return result;
+}
+
+void setParseCacheCapacity(int documents)
+{
+    if (ParseCache *cache = parseCache()) {
+        QMutexLocker locker(&cache->mutex);
+        cache->results.setMaxCost(std::max(documents, 0));
+    }
+}
+
+int parseCacheCapacity()
+{
+    if (ParseCache *cache = parseCache()) {
+        QMutexLocker locker(&cache->mutex);
+        return cache->results.maxCost();
+    }
+    return 0;
+}
+
+BatchParseResult parseBatch(const QList<DocumentSource> &sources, const QString &formatHint, QThreadPool *pool)
+{
+    if (!pool) {
+        pool = QThreadPool::globalInstance();
+    }
+
+    // make sure the collection is created before the workers race for it
+    defaultParserCollection();
+
+    BatchState state(sources, formatHint);
+    const int workerCount = std::min<int>(pool->maxThreadCount(), sources.size()) - 1;
+    std::vector<std::unique_ptr<BatchWorker>> workers;
+    for (int i = 0; i < workerCount; ++i) {
+        workers.push_back(std::make_unique<BatchWorker>(&state));
+        pool->start(workers.back().get());
+    }
+
+    state.work();
+
+    // workers the pool did not get to are no longer needed, wait for the others
+    int running = 0;
+    for (const auto &worker : workers) {
+        if (!pool->tryTake(worker.get())) {
+            ++running;
+        }
+    }
+    state.finished.acquire(running);
+
+    BatchParseResult batch;
+    batch.results.reserve(sources.size());
+    for (int i = 0; i < sources.size(); ++i) {
+        FormatTiming &timing = batch.timings[state.results[i].format];
+        ++timing.documents;
+        timing.nanoseconds += state.nanoseconds[i];
+        batch.results.append(std::move(state.results[i]));
+    }
+    return batch;
+}
+
 } // namespace Syndication
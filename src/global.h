@@ -12,8 +12,12 @@
 
 #include "syndication_export.h"
 
+#include <QHash>
+#include <QList>
 #include <QString>
 
+class QThreadPool;
+
 /*!
  * \namespace Syndication
  * \inmodule Syndication
@@ -29,6 +33,10 @@ class ParserCollection;
  * The default ParserCollection instance parsing
  * a DocumentSource into a Feed object.
  *
+ * The collection stores the error of the last parse (see
+ * ParserCollection::lastError()), so parsing with it from several threads
+ * at once is not safe. Use parseDocument() for that.
+ *
  * Use this to parse a local file or a otherwise
  * manually created DocumentSource object.
  *
@@ -60,13 +68,17 @@ ParserCollection<Feed> *parserCollection();
  * parses a document from a source and returns a new Feed object
  * wrapping the feed content.
  *
- * Shortcut for parserCollection()->parse().
+ * Shortcut for parserCollection()->parse(). Not thread-safe, see
+ * parseDocument() for a thread-safe alternative.
  *
  * See ParserCollection::parse() for more details.
  *
  * \a src the document source to parse
  *
- * \a formatHint an optional hint which format to test first
+ * \a formatHint an optional hint which format to test first. Pass
+ * "rss2stream" to read RSS 0.9x/2.0 feeds with the streaming parser, which
+ * does not build a DOM tree for the document, or "atomstream" to read
+ * Atom 1.0 feeds with Atom::StreamReader.
  */
 SYNDICATION_EXPORT
 FeedPtr parse(const DocumentSource &src, const QString &formatHint = QString());
@@ -86,6 +98,8 @@ FeedPtr parse(const DocumentSource &src, const QString &formatHint = QString());
  * \value XmlNotAccepted The source is valid XML, but no parser accepted it.
  * \value InvalidFormat The source was accepted by a parser, but the actual parsing failed. As our parser implementations currently do not validate the source
  * ("parse what you can get"), this code will be rarely seen.
+ * \value NotModified The retriever reported that the source did not change since it was retrieved with the validators passed to Loader::loadFrom(). Nothing
+ * was parsed.
  */
 enum ErrorCode {
     Success = 0,
@@ -97,8 +111,153 @@ enum ErrorCode {
     InvalidXml = 6,
     XmlNotAccepted = 7,
     InvalidFormat = 8,
+    NotModified = 9,
+};
+
+/*!
+ * \class Syndication::ParseResult
+ * \inmodule Syndication
+ * \inheaderfile Syndication/Global
+ *
+ * \brief The outcome of parseDocument(): the parsed feed together with the
+ * error code of that very parse.
+ */
+struct ParseResult {
+    /*!
+     * the parsed feed, or a null pointer if parsing failed
+     */
+    FeedPtr feed;
+
+    /*!
+     * Success if \c feed is valid, otherwise one of InvalidXml,
+     * XmlNotAccepted or InvalidFormat
+     */
+    ErrorCode error = Success;
+
+    /*!
+     * the format of the parser that accepted the source (e.g. "rss2",
+     * "atom" or "rdf"), or a null string if no parser accepted it
+     */
+    QString format;
+};
+
+/*!
+ * Parses a document from a source, like parse(), but returns the error
+ * code together with the feed instead of storing it in the shared
+ * parserCollection().
+ *
+ * This function is thread-safe: all state of a parse is kept local to the
+ * call, so several threads can parse documents at the same time. It must
+ * not be called concurrently with ParserCollection::registerParser() or
+ * ParserCollection::changeMapper() on parserCollection().
+ *
+ * The source is copied before parsing, so the same DocumentSource can be
+ * passed from several threads, but the DOM tree built for the parse is not
+ * cached in \a src.
+ *
+ * If the parse cache is enabled with setParseCacheCapacity(), sources
+ * with the same content as one parsed before (see DocumentSource::digest())
+ * are not parsed again, but get the earlier result, sharing its feed.
+ *
+ * \a src the document source to parse
+ *
+ * \a formatHint an optional hint which format to test first, see parse()
+ */
+SYNDICATION_EXPORT
+ParseResult parseDocument(const DocumentSource &src, const QString &formatHint = QString());
+
+/*!
+ * Sets the number of results parseDocument() keeps to answer sources with
+ * the same content without parsing them again. The least recently used
+ * results are dropped first. This also applies to parseBatch() and to a
+ * Loader whose retriever only emits DataRetriever::dataRetrieved(), and is
+ * useful when polling feeds that do not support conditional requests.
+ * Documents a Loader parses while they are retrieved, see
+ * DataRetriever::dataReceived(), are read by an IncrementalParser, which
+ * does not use the cache for RSS 0.9x/2.0 and Atom 1.0 feeds.
+ *
+ * The cache is disabled by default. A capacity of 0 disables it and
+ * drops all results. As the feeds of cached results are shared, they must
+ * not be used from several threads at once.
+ *
+ * This function is thread-safe.
+ *
+ * \a documents the maximum number of results to keep
+ */
+SYNDICATION_EXPORT
+void setParseCacheCapacity(int documents);
+
+/*!
+ * Returns the number of results the parse cache keeps, 0 if it is disabled
+ *
+ * \sa setParseCacheCapacity()
+ */
+SYNDICATION_EXPORT
+int parseCacheCapacity();
+
+/*!
+ * \class Syndication::FormatTiming
+ * \inmodule Syndication
+ * \inheaderfile Syndication/Global
+ *
+ * \brief Time spent by parseBatch() on the documents of one format.
+ */
+struct FormatTiming {
+    /*!
+     * the number of documents handled by the format's parser
+     */
+    int documents = 0;
+
+    /*!
+     * the accumulated wall-clock time spent parsing and mapping these
+     * documents, in nanoseconds, summed over all threads
+     */
+    qint64 nanoseconds = 0;
 };
 
+/*!
+ * \class Syndication::BatchParseResult
+ * \inmodule Syndication
+ * \inheaderfile Syndication/Global
+ *
+ * \brief The outcome of parseBatch().
+ */
+struct BatchParseResult {
+    /*!
+     * one result per source, in the order of the sources passed to
+     * parseBatch()
+     */
+    QList<ParseResult> results;
+
+    /*!
+     * timing per format, keyed by ParseResult::format. Documents no
+     * parser accepted are accounted for under a null string.
+     */
+    QHash<QString, FormatTiming> timings;
+};
+
+/*!
+ * Parses many documents at once, spreading the work over the threads of
+ * \a pool. Each document is parsed as if by parseDocument(), so the
+ * results, including the error codes, are exactly the same as parsing the
+ * sources one after the other.
+ *
+ * The calling thread takes part in parsing and the call blocks until all
+ * sources are parsed, so it is safe to call this from a thread of
+ * \a pool itself.
+ *
+ * This function is thread-safe in the same way as parseDocument().
+ *
+ * \a sources the documents to parse
+ *
+ * \a formatHint an optional hint which format to test first, see parse()
+ *
+ * \a pool the thread pool to use, or \c nullptr to use
+ * QThreadPool::globalInstance()
+ */
+SYNDICATION_EXPORT
+BatchParseResult parseBatch(const QList<DocumentSource> &sources, const QString &formatHint = QString(), QThreadPool *pool = nullptr);
+
 } // namespace Syndication
 
 #endif // SYNDICATION_GLOBAL_H
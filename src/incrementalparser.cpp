@@ -0,0 +1,154 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "incrementalparser.h"
+#include "documentsource.h"
+#include "instrumentation_p.h"
+
+#include "atom/constants.h"
+#include "atom/document.h"
+#include "atom/streamreader.h"
+#include "mapper/feedatomimpl.h"
+#include "mapper/feedrss2streamimpl.h"
+#include "rss2/streamreader_p.h"
+
+#include <QByteArray>
+#include <QXmlStreamReader>
+
+namespace Syndication
+{
+class SYNDICATION_NO_EXPORT IncrementalParser::IncrementalParserPrivate
+{
+public:
+    enum Engine {
+        Undecided,
+        RSS2Engine,
+        AtomEngine,
+        FallbackEngine, // not a streamable format, parsed when finished
+    };
+
+    void detectEngine();
+
+    QString url;
+    QByteArray data;
+    Engine engine = Undecided;
+    std::unique_ptr<RSS2::StreamReader> rss2;
+    std::unique_ptr<Atom::StreamReader> atom;
+    ErrorCode lastError = Success;
+
+    // the streamed stages are spread over the addData() calls
+    qint64 acceptNsecs = 0;
+    qint64 parseNsecs = 0;
+};
+
+IncrementalParser::IncrementalParser(const QString &url)
+    : d(new IncrementalParserPrivate)
+{
+    d->url = url;
+}
+
+IncrementalParser::~IncrementalParser() = default;
+
+void IncrementalParser::addData(const QByteArray &data)
+{
+    // the raw data is kept for the fallback and for feed discovery
+    d->data += data;
+
+    const StageTimer timer;
+    if (d->engine == IncrementalParserPrivate::Undecided) {
+        d->detectEngine();
+        d->acceptNsecs += timer.elapsed();
+        return;
+    }
+
+    if (d->rss2) {
+        d->rss2->addData(data);
+    } else if (d->atom) {
+        d->atom->addData(data);
+    }
+    d->parseNsecs += timer.elapsed();
+}
+
+QByteArray IncrementalParser::data() const
+{
+    return d->data;
+}
+
+FeedPtr IncrementalParser::finish()
+{
+    d->lastError = Success;
+
+    if (d->rss2 && !d->rss2->hasError() && d->rss2->isComplete()) {
+        const QString format = QStringLiteral("rss2stream");
+        const StageTimer parsing;
+        RSS2::StreamDocumentPtr doc = d->rss2->finish();
+        if (doc->isValid()) {
+            parsing.report(Instrumentation::Accept, format, d->data.size(), -1, d->acceptNsecs);
+            parsing.report(Instrumentation::Parse, format, d->data.size(), -1, d->parseNsecs + parsing.elapsed());
+            const StageTimer mapping;
+            FeedPtr feed(new FeedRSS2StreamImpl(doc));
+            mapping.finish(Instrumentation::Map, format, d->data.size(), doc->items().size());
+            return feed;
+        }
+    }
+
+    if (d->atom && !d->atom->hasError() && d->atom->isComplete()) {
+        const QString format = QStringLiteral("atomstream");
+        const StageTimer parsing;
+        Atom::FeedDocumentPtr doc(new Atom::FeedDocument(d->atom->feed()));
+        parsing.report(Instrumentation::Accept, format, d->data.size(), -1, d->acceptNsecs);
+        parsing.report(Instrumentation::Parse, format, d->data.size(), -1, d->parseNsecs + parsing.elapsed());
+        const StageTimer mapping;
+        FeedPtr feed(new FeedAtomImpl(doc));
+        if (mapping.isActive()) {
+            const qint64 nsecs = mapping.elapsed();
+            mapping.report(Instrumentation::Map, format, d->data.size(), documentItemCount(doc.data()), nsecs);
+        }
+        return feed;
+    }
+
+    // let the parser collection handle everything else, including
+    // reporting the right error for broken documents
+    const ParseResult result = parseDocument(DocumentSource(d->data, d->url));
+    d->lastError = result.error;
+    return result.feed;
+}
+
+ErrorCode IncrementalParser::lastError() const
+{
+    return d->lastError;
+}
+
+void IncrementalParser::IncrementalParserPrivate::detectEngine()
+{
+    // wait until the root start tag is complete
+    QXmlStreamReader reader(data);
+    while (!reader.atEnd()) {
+        if (reader.readNext() != QXmlStreamReader::StartElement) {
+            continue;
+        }
+
+        if (reader.qualifiedName() == QLatin1String("rss")) {
+            engine = RSS2Engine;
+            rss2.reset(new RSS2::StreamReader);
+            rss2->addData(data);
+        } else if (reader.name() == QLatin1String("feed") && reader.namespaceUri() == Atom::atom1Namespace()) {
+            engine = AtomEngine;
+            atom.reset(new Atom::StreamReader);
+            atom->addData(data);
+        } else {
+            engine = FallbackEngine;
+        }
+        return;
+    }
+
+    if (reader.error() != QXmlStreamReader::PrematureEndOfDocumentError) {
+        engine = FallbackEngine;
+    }
+}
+
+} // namespace Syndication
@@ -0,0 +1,93 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_INCREMENTALPARSER_H
+#define SYNDICATION_INCREMENTALPARSER_H
+
+#include "global.h"
+
+#include "syndication_export.h"
+
+#include <QString>
+
+#include <memory>
+
+class QByteArray;
+
+namespace Syndication
+{
+/*!
+ * \class Syndication::IncrementalParser
+ * \inmodule Syndication
+ * \inheaderfile Syndication/IncrementalParser
+ *
+ * \brief A parser session that is fed the document in chunks.
+ *
+ * Data can be added as it arrives, e.g. from DataRetriever::dataReceived(),
+ * so most of the parsing work is done while the transfer is still running
+ * and finish() only has to complete it:
+ *
+ * \code
+ * IncrementalParser parser(url.url());
+ * parser.addData(chunk1);
+ * parser.addData(chunk2);
+ * FeedPtr feed = parser.finish();
+ * if (parser.lastError() != Syndication::Success) {
+ *     // handle error
+ * }
+ * \endcode
+ *
+ * RSS 0.9x/2.0 and Atom 1.0 documents are parsed incrementally by the
+ * streaming parsers (see the "rss2stream" and "atomstream" format hints
+ * of parse()). Other formats, and documents the streaming parsers cannot
+ * read, are parsed with parse() by finish().
+ */
+class SYNDICATION_EXPORT IncrementalParser
+{
+public:
+    /*!
+     * creates a parser session
+     *
+     * \a url the URL/path the document is read from
+     */
+    explicit IncrementalParser(const QString &url = QString());
+
+    ~IncrementalParser();
+
+    /*!
+     * appends \a data to the document and parses as much of it as possible
+     */
+    void addData(const QByteArray &data);
+
+    /*!
+     * Returns the data added so far
+     */
+    Q_REQUIRED_RESULT QByteArray data() const;
+
+    /*!
+     * completes parsing after all data was added
+     *
+     * Returns the parsed feed, or a null pointer if the document could
+     * not be parsed. See lastError() for the reason.
+     */
+    Q_REQUIRED_RESULT FeedPtr finish();
+
+    /*!
+     * Returns the error of the last finish() call
+     */
+    Q_REQUIRED_RESULT ErrorCode lastError() const;
+
+private:
+    Q_DISABLE_COPY(IncrementalParser)
+
+    class IncrementalParserPrivate;
+    std::unique_ptr<IncrementalParserPrivate> const d;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_INCREMENTALPARSER_H
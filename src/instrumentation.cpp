@@ -0,0 +1,134 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "instrumentation.h"
+#include "instrumentation_p.h"
+#include "documentvisitor.h"
+
+#include "atom/constants.h"
+#include "atom/document.h"
+#include "rdf/document.h"
+#include "rss2/document.h"
+#include "rss2/streamdocument.h"
+
+#include <QHash>
+#include <QMutex>
+
+#include <algorithm>
+
+namespace Syndication
+{
+std::atomic<Instrumentation *> installedInstrumentation{nullptr};
+
+namespace
+{
+class ItemCountVisitor : public DocumentVisitor
+{
+public:
+    qint64 count = -1;
+
+    bool visitRSS2Document(Syndication::RSS2::Document *document) override
+    {
+        count = document->elementsByTagNameNS(QString(), QStringLiteral("item")).size();
+        return true;
+    }
+
+    bool visitRDFDocument(Syndication::RDF::Document *document) override
+    {
+        // cached by the document, so the mapper does not sort the items again
+        count = document->items().size();
+        return true;
+    }
+
+    bool visitAtomFeedDocument(Syndication::Atom::FeedDocument *document) override
+    {
+        count = document->elementsByTagNameNS(Atom::atom1Namespace(), QStringLiteral("entry")).size();
+        return true;
+    }
+};
+} // namespace
+
+qint64 documentItemCount(SpecificDocument *document)
+{
+    if (!document) {
+        return -1;
+    }
+    if (const auto *stream = dynamic_cast<const RSS2::StreamDocument *>(document)) {
+        return stream->items().size();
+    }
+    ItemCountVisitor visitor;
+    visitor.visit(document);
+    return visitor.count;
+}
+
+Instrumentation::~Instrumentation()
+{
+}
+
+void setInstrumentation(Instrumentation *instrumentation)
+{
+    installedInstrumentation.store(instrumentation, std::memory_order_release);
+}
+
+Instrumentation *instrumentation()
+{
+    return installedInstrumentation.load(std::memory_order_acquire);
+}
+
+class SYNDICATION_NO_EXPORT InstrumentationCounters::InstrumentationCountersPrivate
+{
+public:
+    mutable QMutex mutex;
+    QHash<QString, StageCounters> counters[Map + 1]; // per stage, by format
+};
+
+InstrumentationCounters::InstrumentationCounters()
+    : d(new InstrumentationCountersPrivate)
+{
+}
+
+InstrumentationCounters::~InstrumentationCounters() = default;
+
+void InstrumentationCounters::stageFinished(const Report &report)
+{
+    QMutexLocker locker(&d->mutex);
+    StageCounters &counters = d->counters[report.stage][report.format];
+    ++counters.count;
+    counters.bytes += report.bytes;
+    counters.items += std::max<qint64>(report.items, 0);
+    counters.nsecs += report.nsecs;
+    counters.maxNsecs = std::max(counters.maxNsecs, report.nsecs);
+}
+
+StageCounters InstrumentationCounters::counters(Stage stage, const QString &format) const
+{
+    QMutexLocker locker(&d->mutex);
+    const QHash<QString, StageCounters> &byFormat = d->counters[stage];
+    if (!format.isEmpty()) {
+        return byFormat.value(format);
+    }
+
+    StageCounters sum;
+    for (const StageCounters &counters : byFormat) {
+        sum.count += counters.count;
+        sum.bytes += counters.bytes;
+        sum.items += counters.items;
+        sum.nsecs += counters.nsecs;
+        sum.maxNsecs = std::max(sum.maxNsecs, counters.maxNsecs);
+    }
+    return sum;
+}
+
+void InstrumentationCounters::reset()
+{
+    QMutexLocker locker(&d->mutex);
+    for (QHash<QString, StageCounters> &byFormat : d->counters) {
+        byFormat.clear();
+    }
+}
+
+} // namespace Syndication
@@ -0,0 +1,215 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_INSTRUMENTATION_H
+#define SYNDICATION_INSTRUMENTATION_H
+
+#include "syndication_export.h"
+
+#include <QString>
+
+#include <memory>
+
+namespace Syndication
+{
+/*!
+ * \class Syndication::Instrumentation
+ * \inmodule Syndication
+ * \inheaderfile Syndication/Instrumentation
+ *
+ * \brief Interface to observe where the time of loading and parsing
+ * feeds goes.
+ *
+ * Install an implementation with setInstrumentation() to be told about
+ * every stage the library finishes: a Loader finishing a download,
+ * building the DOM of a DocumentSource, and finding the parser for, parsing
+ * and mapping a document in the parser collection.
+ *
+ * Stages of parallel parses, e.g. from parseBatch(), are reported from
+ * the threads they run in, so implementations must be thread-safe. The
+ * DOM of a document is usually built while its parser checks or parses
+ * it, so a BuildDom report is part of the enclosing Accept or Parse time.
+ *
+ * Documents an IncrementalParser reads with a streaming parser, e.g. in a
+ * Loader whose retriever emits DataRetriever::dataReceived(), are reported
+ * by IncrementalParser::finish(), with the Accept and Parse times summed
+ * up over all IncrementalParser::addData() calls.
+ *
+ * See InstrumentationCounters for an implementation that sums up the
+ * reports.
+ */
+class SYNDICATION_EXPORT Instrumentation // krazy:exclude=dpointer
+{
+public:
+    /*!
+     * \value Fetch A Loader received the complete document from its
+     * DataRetriever. The time is counted from Loader::loadFrom().
+     * \value BuildDom The DOM tree of a DocumentSource was built.
+     * \value Accept A parser accepted a document. The time includes the
+     * AbstractParser::accept() calls of the parsers that rejected it.
+     * \value Parse The format-specific document was parsed.
+     * \value Map The format-specific document was mapped to a Feed.
+     */
+    enum Stage {
+        Fetch,
+        BuildDom,
+        Accept,
+        Parse,
+        Map,
+    };
+
+    /*!
+     * \class Syndication::Instrumentation::Report
+     * \inmodule Syndication
+     * \inheaderfile Syndication/Instrumentation
+     *
+     * \brief A finished stage.
+     */
+    struct Report {
+        /*!
+         * the stage
+         */
+        Stage stage = Fetch;
+
+        /*!
+         * the format of the parser (e.g. "rss2"), or an empty string for
+         * the Fetch and BuildDom stages
+         */
+        QString format;
+
+        /*!
+         * the size of the document in bytes
+         */
+        qint64 bytes = 0;
+
+        /*!
+         * the number of items of the feed, or -1 if not known at this stage.
+         * Only Map reports know it.
+         */
+        qint64 items = -1;
+
+        /*!
+         * the time the stage took, in nanoseconds
+         */
+        qint64 nsecs = 0;
+    };
+
+    virtual ~Instrumentation();
+
+    /*!
+     * called whenever a stage is finished
+     *
+     * \a report what was done and how long it took
+     */
+    virtual void stageFinished(const Report &report) = 0;
+};
+
+/*!
+ * Installs \a instrumentation to be told about the stages of loading and
+ * parsing, replacing the one installed before. Pass \c nullptr to turn
+ * instrumentation off, which is the default. Without instrumentation, no
+ * time is measured at all.
+ *
+ * Ownership is not transferred. The instrumentation must stay alive as
+ * long as it is installed and no parse that started meanwhile is running.
+ *
+ * This function is thread-safe.
+ */
+SYNDICATION_EXPORT
+void setInstrumentation(Instrumentation *instrumentation);
+
+/*!
+ * returns the installed instrumentation, or \c nullptr if there is none
+ */
+SYNDICATION_EXPORT
+Instrumentation *instrumentation();
+
+/*!
+ * \class Syndication::StageCounters
+ * \inmodule Syndication
+ * \inheaderfile Syndication/Instrumentation
+ *
+ * \brief Sums of the reports of one stage, see InstrumentationCounters.
+ */
+struct StageCounters {
+    /*!
+     * the number of reports
+     */
+    qint64 count = 0;
+
+    /*!
+     * the sum of the document sizes, in bytes
+     */
+    qint64 bytes = 0;
+
+    /*!
+     * the sum of the item counts of the reports knowing it
+     */
+    qint64 items = 0;
+
+    /*!
+     * the sum of the times, in nanoseconds
+     */
+    qint64 nsecs = 0;
+
+    /*!
+     * the longest time of a single report, in nanoseconds
+     */
+    qint64 maxNsecs = 0;
+};
+
+/*!
+ * \class Syndication::InstrumentationCounters
+ * \inmodule Syndication
+ * \inheaderfile Syndication/Instrumentation
+ *
+ * \brief Instrumentation summing up the reports per stage and format.
+ *
+ * \code
+ * static InstrumentationCounters counters;
+ * setInstrumentation(&counters);
+ * ...
+ * const StageCounters parse = counters.counters(Instrumentation::Parse, QStringLiteral("rss2"));
+ * const qint64 averageNsecs = parse.count ? parse.nsecs / parse.count : 0;
+ * \endcode
+ *
+ * Subclasses can override stageFinished() to also record single
+ * reports, e.g. into latency histograms, and call the base implementation
+ * to keep the counters.
+ */
+class SYNDICATION_EXPORT InstrumentationCounters : public Instrumentation
+{
+public:
+    InstrumentationCounters();
+    ~InstrumentationCounters() override;
+
+    /*!
+     * adds \a report to the counters of its stage and format
+     */
+    void stageFinished(const Report &report) override;
+
+    /*!
+     * returns the sums for \a stage and \a format, or for all formats
+     * if \a format is empty
+     */
+    Q_REQUIRED_RESULT StageCounters counters(Stage stage, const QString &format = QString()) const;
+
+    /*!
+     * sets all counters back to zero
+     */
+    void reset();
+
+private:
+    class InstrumentationCountersPrivate;
+    std::unique_ptr<InstrumentationCountersPrivate> const d;
+
+    Q_DISABLE_COPY(InstrumentationCounters)
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_INSTRUMENTATION_H
@@ -0,0 +1,105 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_INSTRUMENTATION_P_H
+#define SYNDICATION_INSTRUMENTATION_P_H
+
+#include "instrumentation.h"
+
+#include <QElapsedTimer>
+
+#include <atomic>
+
+namespace Syndication
+{
+class SpecificDocument;
+
+//@cond PRIVATE
+/*!
+ * \internal
+ * the installed instrumentation, see setInstrumentation()
+ */
+extern std::atomic<Instrumentation *> installedInstrumentation;
+
+/*!
+ * \internal
+ * returns the number of items of \a document for Map reports, counted
+ * without mapping them, or -1 for unknown formats
+ */
+qint64 documentItemCount(SpecificDocument *document);
+
+/*!
+ * \internal
+ *
+ * Measures a stage if instrumentation is installed when it is created,
+ * otherwise does nothing beyond loading one pointer:
+ *
+ * \code
+ * StageTimer timer;
+ * doTheWork();
+ * timer.finish(Instrumentation::Parse, format, size);
+ * \endcode
+ */
+class StageTimer
+{
+public:
+    StageTimer()
+        : m_instrumentation(installedInstrumentation.load(std::memory_order_acquire))
+    {
+        if (m_instrumentation) {
+            m_timer.start();
+        }
+    }
+
+    bool isActive() const
+    {
+        return m_instrumentation != nullptr;
+    }
+
+    /*!
+     * reports the time since construction
+     */
+    void finish(Instrumentation::Stage stage, const QString &format, qint64 bytes, qint64 items = -1) const
+    {
+        if (m_instrumentation) {
+            report(stage, format, bytes, items, m_timer.nsecsElapsed());
+        }
+    }
+
+    /*!
+     * reports \a nsecs instead of the time since construction
+     */
+    void report(Instrumentation::Stage stage, const QString &format, qint64 bytes, qint64 items, qint64 nsecs) const
+    {
+        if (m_instrumentation) {
+            Instrumentation::Report report;
+            report.stage = stage;
+            report.format = format;
+            report.bytes = bytes;
+            report.items = items;
+            report.nsecs = nsecs;
+            m_instrumentation->stageFinished(report);
+        }
+    }
+
+    /*!
+     * nanoseconds since construction, 0 if not active
+     */
+    qint64 elapsed() const
+    {
+        return m_instrumentation ? m_timer.nsecsElapsed() : 0;
+    }
+
+private:
+    Instrumentation *const m_instrumentation;
+    QElapsedTimer m_timer;
+};
+//@endcond
+
+} // namespace Syndication
+
+#endif // SYNDICATION_INSTRUMENTATION_P_H
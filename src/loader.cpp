@@ -10,11 +10,13 @@
 #include "documentsource.h"
 #include "feed.h"
 #include "global.h"
+#include "incrementalparser.h"
+#include "instrumentation_p.h"
 #include "loaderutil_p.h"
-#include "parsercollection.h"
 
 #include <QUrl>
 
+#include <optional>
 
 #include <syndication_debug.h>
 
@@ -31,10 +33,13 @@ struct SYNDICATION_NO_EXPORT Loader::LoaderPrivate {
     }
 
     DataRetriever *retriever = nullptr;
+    std::unique_ptr<IncrementalParser> incrementalParser;
     Syndication::ErrorCode lastError = Success;
     int retrieverError = 0;
-    QUrl discoveredFeedURL;
+    QList<FeedCandidate> discoveredFeeds;
+    FeedValidators validators;
     QUrl url;
+    std::optional<StageTimer> fetchTimer; // measures the download if instrumentation is installed
 };
 
 Loader *Loader::create()
@@ -57,6 +62,11 @@ Loader::Loader()
 Loader::~Loader() = default;
 
 void Loader::loadFrom(const QUrl &url, DataRetriever *retriever)
+{
+    loadFrom(url, retriever, FeedValidators());
+}
+
+void Loader::loadFrom(const QUrl &url, DataRetriever *retriever, const FeedValidators &validators)
 {
     if (d->retriever != nullptr) {
         return;
@@ -64,10 +74,19 @@ void Loader::loadFrom(const QUrl &url, DataRetriever *retriever)
 
     d->url = url;
     d->retriever = retriever;
+    d->validators = validators;
+    d->fetchTimer.emplace();
 
     connect(d->retriever, &DataRetriever::dataRetrieved, this, &Loader::slotRetrieverDone);
+    connect(d->retriever, &DataRetriever::dataReceived, this, &Loader::slotDataReceived);
+    connect(d->retriever, &DataRetriever::validatorsReceived, this, &Loader::slotValidatorsReceived);
+    connect(d->retriever, &DataRetriever::notModified, this, &Loader::slotNotModified);
 
-    d->retriever->retrieveData(url);
+    if (auto conditional = qobject_cast<ConditionalDataRetriever *>(d->retriever)) {
+        conditional->retrieveData(url, validators);
+    } else {
+        d->retriever->retrieveData(url);
+    }
 }
 
 int Loader::retrieverError() const
@@ -94,7 +113,17 @@ void Loader::abort()
 
 QUrl Loader::discoveredFeedURL() const
 {
-    return d->discoveredFeedURL;
+    return d->discoveredFeeds.isEmpty() ? QUrl() : d->discoveredFeeds.first().url;
+}
+
+QList<FeedCandidate> Loader::discoveredFeeds() const
+{
+    return d->discoveredFeeds;
+}
+
+FeedValidators Loader::validators() const
+{
+    return d->validators;
 }
 
 void Loader::slotRetrieverDone(const QByteArray &data, bool success)
@@ -106,11 +135,21 @@ void Loader::slotRetrieverDone(const QByteArray &data, bool success)
     d->retriever = nullptr;
 
     if (success) {
-        DocumentSource src(data, d->url.url());
-        feed = parserCollection()->parse(src);
+        if (d->fetchTimer) {
+            d->fetchTimer->finish(Instrumentation::Fetch, QString(), data.size());
+        }
 
-        if (parserCollection()->lastError() != Syndication::Success) {
-            status = parserCollection()->lastError();
+        if (d->incrementalParser && d->incrementalParser->data().size() == data.size()) {
+            // the document was parsed while it was retrieved
+            feed = d->incrementalParser->finish();
+            status = d->incrementalParser->lastError();
+        } else {
+            const ParseResult result = parseDocument(DocumentSource(data, d->url.url()));
+            feed = result.feed;
+            status = result.error;
+        }
+
+        if (status != Syndication::Success) {
             discoverFeeds(data);
         }
     } else {
@@ -119,16 +158,42 @@ void Loader::slotRetrieverDone(const QByteArray &data, bool success)
         status = OtherRetrieverError;
     }
 
+    d->lastError = status;
     Q_EMIT loadingComplete(this, feed, status);
 
     delete this;
 }
 
+void Loader::slotValidatorsReceived(const FeedValidators &validators)
+{
+    d->validators = validators;
+}
+
+void Loader::slotNotModified()
+{
+    d->retrieverError = d->retriever->errorCode();
+    delete d->retriever;
+    d->retriever = nullptr;
+
+    d->lastError = NotModified;
+    Q_EMIT loadingComplete(this, FeedPtr(), NotModified);
+
+    delete this;
+}
+
+void Loader::slotDataReceived(const QByteArray &data)
+{
+    if (!d->incrementalParser) {
+        d->incrementalParser.reset(new IncrementalParser(d->url.url()));
+    }
+    d->incrementalParser->addData(data);
+}
+
 void Loader::discoverFeeds(const QByteArray &data)
 {
-    const QUrl url = LoaderUtil::parseFeed(data, d->url);
-    if (!url.isEmpty()) {
-        d->discoveredFeedURL = url;
+    const QList<FeedCandidate> candidates = LoaderUtil::feedCandidates(data, d->url);
+    if (!candidates.isEmpty()) {
+        d->discoveredFeeds = candidates;
     }
 }
 
@@ -8,22 +8,48 @@
 #ifndef SYNDICATION_LOADER_H
 #define SYNDICATION_LOADER_H
 
+#include "dataretriever.h"
 #include "global.h"
 
 #include "syndication_export.h"
 
+#include <QList>
 #include <QObject>
+#include <QString>
+#include <QUrl>
 
 #include <memory>
 
-class QUrl;
-
 namespace Syndication
 {
-class DataRetriever;
 class Feed;
 typedef QSharedPointer<Feed> FeedPtr;
 
+/*!
+ * \class Syndication::FeedCandidate
+ * \inmodule Syndication
+ * \inheaderfile Syndication/Loader
+ *
+ * \brief A feed linked from a HTML page, see Loader::discoveredFeeds().
+ */
+struct FeedCandidate {
+    /*!
+     * the absolute URL of the feed
+     */
+    QUrl url;
+
+    /*!
+     * the MIME type given by the page, e.g. "application/atom+xml", or an
+     * empty string if the feed was guessed from a plain link
+     */
+    QString type;
+
+    /*!
+     * the title given by the page, or an empty string
+     */
+    QString title;
+};
+
 /*!
  * \class Syndication::Loader
  * \inmodule Syndication
@@ -56,6 +82,11 @@ typedef QSharedPointer<Feed> FeedPtr;
  * stdout is RSS/Azom markup. This is e.g. handy for conversion scripts, which
  * download a HTML file and convert it's contents into RSS markup.
  *
+ * If the retriever emits DataRetriever::dataReceived(), the document is
+ * parsed while it is still being retrieved. RSS 0.9x/2.0 feeds are then read
+ * with the streaming parser, so Feed::specificDocument() returns a
+ * RSS2::StreamDocument instead of a RSS2::Document.
+ *
  * No matter what kind of retrieval algorithm you employ, your
  * 'slotLoadingComplete' method might look like this:
  *
@@ -127,6 +158,23 @@ public:
      */
     void loadFrom(const QUrl &url, DataRetriever *retriever);
 
+    /*!
+     * Loads the feed source referenced by the given URL, unless it did not
+     * change since it was loaded with \a validators.
+     *
+     * If \a retriever is a ConditionalDataRetriever, it is asked to send
+     * the validators, and if it reports the source as unchanged,
+     * loadingComplete() is emitted with NotModified and a null feed,
+     * without parsing anything. Other retrievers load the source as usual.
+     *
+     * \a url A URL referencing the input file.
+     *
+     * \a retriever the retriever, see loadFrom(const QUrl &, DataRetriever *)
+     *
+     * \a validators the validators() of the last time the source was loaded
+     */
+    void loadFrom(const QUrl &url, DataRetriever *retriever, const FeedValidators &validators);
+
     /*!
      * Retrieves the error code of the last loading process (if any).
      */
@@ -141,9 +189,32 @@ public:
 
     /*!
      * returns the URL of a feed discovered in the feed source
+     *
+     * This is the URL of the first of discoveredFeeds(), or an empty URL.
      */
     Q_REQUIRED_RESULT QUrl discoveredFeedURL() const;
 
+    /*!
+     * returns all feeds discovered in the feed source
+     *
+     * If the source is no feed but a HTML page, it is searched for links
+     * to feeds. Alternate links to RSS feeds come first, then those to Atom
+     * and then to RDF feeds, each in the order of the page. They are
+     * followed by plain links to files that look like feeds.
+     * These can be used to load all alternatives without retrieving the page
+     * again.
+     */
+    Q_REQUIRED_RESULT QList<FeedCandidate> discoveredFeeds() const;
+
+    /*!
+     * returns the cache validators the retriever reported for the source
+     *
+     * If the source was not modified, these are the validators passed to
+     * loadFrom() unless the retriever reported new ones. Store them and pass
+     * them to loadFrom() the next time the source is loaded.
+     */
+    Q_REQUIRED_RESULT FeedValidators validators() const;
+
     /*!
      * aborts the loading process
      */
@@ -171,6 +242,9 @@ Q_SIGNALS:
 
 private Q_SLOTS:
     SYNDICATION_NO_EXPORT void slotRetrieverDone(const QByteArray &data, bool success);
+    SYNDICATION_NO_EXPORT void slotDataReceived(const QByteArray &data);
+    SYNDICATION_NO_EXPORT void slotValidatorsReceived(const Syndication::FeedValidators &validators);
+    SYNDICATION_NO_EXPORT void slotNotModified();
 
 private:
     SYNDICATION_NO_EXPORT Loader();
@@ -6,102 +6,318 @@
 */
 
 #include "loaderutil_p.h"
+#include "tools.h"
+
+#include <QByteArrayView>
 #include <QDebug>
-#include <QRegularExpression>
+#include <QSet>
+
+#include <algorithm>
 
 // #define DEBUG_PARSING_FEED
 #ifdef DEBUG_PARSING_FEED
 #include <QFile>
 #include <QTextStream>
 #endif
-QUrl Syndication::LoaderUtil::parseFeed(const QByteArray &data, const QUrl &url)
+
+namespace
 {
-#ifdef DEBUG_PARSING_FEED
-    qDebug() << " QUrl Syndication::LoaderUtil::parseFeed(const QByteArray &data, const QUrl &url)";
-    QFile headerFile(QStringLiteral("/tmp/bb.txt"));
-    headerFile.open(QIODevice::WriteOnly | QIODevice::Text);
-    QTextStream outHeaderStream(&headerFile);
-    outHeaderStream << data;
-    headerFile.close();
-#endif
-    QUrl discoveredFeedURL;
-    QString str = QString::fromLatin1(data.constData()).simplified();
-    QString s2;
-    // QTextStream ts( &str, QIODevice::WriteOnly );
-    // ts << data.data();
-
-    // "<[\\s]link[^>]*rel[\\s]=[\\s]\\\"[\\s]alternate[\\s]\\\"[^>]*>"
-    // "type[\\s]=[\\s]\\\"application/rss+xml\\\""
-    // "href[\\s]=[\\s]\\\"application/rss+xml\\\""
-
-    // test regexp: https://www.regexplanet.com/advanced/perl/index.html
-
-    const static QRegularExpression rx0(
-        QStringLiteral(
-            R"((?:REL)[^=]*=[^sAa]*(?:service.feed|ALTERNATE)[^sAa]*[\s]*type[^=]*="application/rss\+xml"[^s]*[\s]*[^s]*(?:HREF)[^=]*?=[^A-Z0-9-_~,./$]*([^'\">\s]*))"),
-        QRegularExpression::CaseInsensitiveOption);
-
-    QRegularExpressionMatch match;
-    if ((match = rx0.match(str)).hasMatch()) {
-        s2 = match.captured(1);
-    } else {
-        const static QRegularExpression rx(
-            QStringLiteral(
-                R"((?:REL)[^=]*=[^sAa]*(?:service.feed|ALTERNATE)[^sAa]*[\s]*type[^=]*=\"application/rss\+xml\"[^s][^s](?:[^>]*)[\s]*[^s]*(?:HREF)[^=]*=[^A-Z0-9-_~,./$]*([^'\">\s]*))"),
-            QRegularExpression::CaseInsensitiveOption);
-        if ((match = rx.match(str)).hasMatch()) {
-            s2 = match.captured(1);
-        } else {
-            static const QRegularExpression rx2(
-                QStringLiteral(R"((?:REL)[^=]*=[^sAa]*(?:service.feed|ALTERNATE)[\s]*[^s][^s](?:[^>]*)(?:HREF)[^=]*=[^A-Z0-9-_~,./$]*([^'\">\s]*))"),
-                QRegularExpression::CaseInsensitiveOption);
-            if ((match = rx2.match(str)).hasMatch()) {
-                s2 = match.captured(1);
-            } else {
-                // does not support Atom/RSS autodiscovery.. try finding feeds by brute force....
-                QStringList feeds;
-                QString host = url.host();
-                static const QRegularExpression rx3(QStringLiteral(R"((?:<A )[^H]*(?:HREF)[^=]*=[^A-Z0-9-_~,./]*([^'\">\s]*))"));
-                QRegularExpressionMatchIterator iter = rx3.globalMatch(str);
-                while (iter.hasNext()) {
-                    match = iter.next();
-                    s2 = match.captured(1);
-                    if (s2.endsWith(QLatin1String(".rdf")) //
-                        || s2.endsWith(QLatin1String(".rss")) //
-                        || s2.endsWith(QLatin1String(".xml"))) {
-                        feeds.append(s2);
-                    }
+bool isHtmlSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+bool equalsIgnoringCase(QByteArrayView a, QByteArrayView b)
+{
+    return a.compare(b, Qt::CaseInsensitive) == 0;
+}
+
+// the attributes of a start tag we are interested in
+struct Tag {
+    QByteArrayView name;
+    QByteArrayView rel;
+    QByteArrayView type;
+    QByteArrayView href;
+    QByteArrayView title;
+};
+
+// Splits HTML into tags in a single pass. Comments and the contents of
+// <script> and <style> elements are skipped.
+class HtmlTokenizer
+{
+public:
+    explicit HtmlTokenizer(QByteArrayView html)
+        : m_html(html)
+    {
+    }
+
+    // reads the next start or end tag, returns false at the end of the document
+    bool next(Tag *tag, bool *isEndTag)
+    {
+        while (true) {
+            const qsizetype open = m_html.indexOf('<', m_pos);
+            if (open == -1 || open + 1 == m_html.size()) {
+                return false;
+            }
+            m_pos = open + 1;
+
+            const QByteArrayView rest = m_html.sliced(m_pos);
+            if (rest.startsWith("!--")) {
+                skipPast("-->");
+                continue;
+            }
+            *isEndTag = rest.startsWith('/');
+            if (*isEndTag) {
+                ++m_pos;
+            }
+
+            const qsizetype nameStart = m_pos;
+            while (m_pos < m_html.size() && isAsciiLetterOrDigit(m_html.at(m_pos))) {
+                ++m_pos;
+            }
+            if (m_pos == nameStart || !isAsciiLetter(m_html.at(nameStart))) {
+                // "<!DOCTYPE", "<?xml", or a plain '<' in text
+                continue;
+            }
+
+            *tag = Tag();
+            tag->name = m_html.sliced(nameStart, m_pos - nameStart);
+            readAttributes(tag);
+
+            if (!*isEndTag) {
+                if (equalsIgnoringCase(tag->name, "script")) {
+                    skipPast("</script");
+                } else if (equalsIgnoringCase(tag->name, "style")) {
+                    skipPast("</style");
                 }
+            }
+            return true;
+        }
+    }
+
+private:
+    static bool isAsciiLetter(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    static bool isAsciiLetterOrDigit(char c)
+    {
+        return isAsciiLetter(c) || (c >= '0' && c <= '9');
+    }
+
+    void skipPast(QByteArrayView marker)
+    {
+        // matched case-insensitively, "</SCRIPT" is common enough
+        while (true) {
+            const qsizetype found = m_html.indexOf(marker.front(), m_pos);
+            if (found == -1 || found + marker.size() > m_html.size()) {
+                m_pos = m_html.size();
+                return;
+            }
+            m_pos = found + 1;
+            if (equalsIgnoringCase(m_html.sliced(found, marker.size()), marker)) {
+                m_pos = found + marker.size();
+                return;
+            }
+        }
+    }
+
+    void readAttributes(Tag *tag)
+    {
+        const qsizetype size = m_html.size();
+        while (m_pos < size) {
+            const char c = m_html.at(m_pos);
+            if (c == '>') {
+                ++m_pos;
+                return;
+            }
+            if (isHtmlSpace(c) || c == '/') {
+                ++m_pos;
+                continue;
+            }
 
-                // Prefer feeds on same host
-                auto it = std::find_if(feeds.cbegin(), feeds.cend(), [&host](const QString &s) {
-                    return QUrl(s).host() == host;
-                });
-                if (it != feeds.cend()) {
-                    s2 = *it;
+            const qsizetype nameStart = m_pos;
+            while (m_pos < size && !isHtmlSpace(m_html.at(m_pos)) && m_html.at(m_pos) != '=' && m_html.at(m_pos) != '>' && m_html.at(m_pos) != '/') {
+                ++m_pos;
+            }
+            const QByteArrayView name = m_html.sliced(nameStart, m_pos - nameStart);
+            while (m_pos < size && isHtmlSpace(m_html.at(m_pos))) {
+                ++m_pos;
+            }
+
+            QByteArrayView value;
+            if (m_pos < size && m_html.at(m_pos) == '=') {
+                ++m_pos;
+                while (m_pos < size && isHtmlSpace(m_html.at(m_pos))) {
+                    ++m_pos;
+                }
+                if (m_pos < size && (m_html.at(m_pos) == '"' || m_html.at(m_pos) == '\'')) {
+                    const qsizetype valueEnd = m_html.indexOf(m_html.at(m_pos), m_pos + 1);
+                    const qsizetype end = valueEnd == -1 ? size : valueEnd;
+                    value = m_html.sliced(m_pos + 1, end - m_pos - 1);
+                    m_pos = qMin(end + 1, size);
+                } else {
+                    const qsizetype valueStart = m_pos;
+                    while (m_pos < size && !isHtmlSpace(m_html.at(m_pos)) && m_html.at(m_pos) != '>') {
+                        ++m_pos;
+                    }
+                    value = m_html.sliced(valueStart, m_pos - valueStart);
                 }
             }
+
+            if (equalsIgnoringCase(name, "rel")) {
+                tag->rel = value;
+            } else if (equalsIgnoringCase(name, "type")) {
+                tag->type = value;
+            } else if (equalsIgnoringCase(name, "href")) {
+                tag->href = value;
+            } else if (equalsIgnoringCase(name, "title")) {
+                tag->title = value;
+            }
+        }
+    }
+
+    QByteArrayView m_html;
+    qsizetype m_pos = 0;
+};
+
+// whether the space separated list of link types in rel contains an alternate
+// or feed link ("service.feed" is used by some blogging engines)
+bool isFeedRelation(QByteArrayView rel)
+{
+    qsizetype pos = 0;
+    while (pos < rel.size()) {
+        while (pos < rel.size() && isHtmlSpace(rel.at(pos))) {
+            ++pos;
+        }
+        qsizetype end = pos;
+        while (end < rel.size() && !isHtmlSpace(rel.at(end))) {
+            ++end;
         }
+        const QByteArrayView token = rel.sliced(pos, end - pos);
+        if (equalsIgnoringCase(token, "alternate") || equalsIgnoringCase(token, "feed") || equalsIgnoringCase(token, "service.feed")) {
+            return true;
+        }
+        pos = end;
     }
+    return false;
+}
+
+// candidates are ordered by these, then by their position in the document
+enum Rank {
+    RssLink,
+    AtomLink,
+    RdfLink,
+    XmlLink,
+    SameHostAnchor,
+    OtherAnchor,
+    NoFeed,
+};
 
-    if (s2.isNull()) {
-        return discoveredFeedURL;
+Rank rankOfLinkType(QByteArrayView type)
+{
+    // ignore parameters such as "; charset=utf-8"
+    const qsizetype semicolon = type.indexOf(';');
+    const QByteArrayView mimeType = (semicolon == -1 ? type : type.first(semicolon)).trimmed();
+    if (equalsIgnoringCase(mimeType, "application/rss+xml")) {
+        return RssLink;
+    } else if (equalsIgnoringCase(mimeType, "application/atom+xml")) {
+        return AtomLink;
+    } else if (equalsIgnoringCase(mimeType, "application/rdf+xml")) {
+        return RdfLink;
+    } else if (equalsIgnoringCase(mimeType, "application/xml") || equalsIgnoringCase(mimeType, "text/xml")) {
+        return XmlLink;
     }
+    return NoFeed;
+}
+
+bool looksLikeFeed(const QUrl &url)
+{
+    const QString path = url.path();
+    return path.endsWith(QLatin1String(".rdf")) //
+        || path.endsWith(QLatin1String(".rss")) //
+        || path.endsWith(QLatin1String(".xml")) //
+        || path.endsWith(QLatin1String(".atom"));
+}
+
+QString attributeValue(QByteArrayView value)
+{
+    const QString str = QString::fromUtf8(value).trimmed();
+    return str.contains(QLatin1Char('&')) ? Syndication::resolveEntities(str) : str;
+}
+
+struct RankedCandidate {
+    Syndication::FeedCandidate candidate;
+    Rank rank;
+};
+} // namespace
 
-    if (QUrl(s2).isRelative()) {
-        if (s2.startsWith(QLatin1String("//"))) {
-            s2.prepend(url.scheme() + QLatin1Char(':'));
-            discoveredFeedURL = QUrl(s2);
-        } else if (s2.startsWith(QLatin1Char('/'))) {
-            discoveredFeedURL = url;
-            discoveredFeedURL.setPath(s2);
-        } else {
-            discoveredFeedURL = url;
-            discoveredFeedURL.setPath(discoveredFeedURL.path() + QLatin1Char('/') + s2);
+QList<Syndication::FeedCandidate> Syndication::LoaderUtil::feedCandidates(const QByteArray &data, const QUrl &url)
+{
+    QList<RankedCandidate> ranked;
+    QUrl baseUrl = url;
+    bool hasLinks = false;
+
+    HtmlTokenizer tokenizer(data);
+    Tag tag;
+    bool isEndTag;
+    while (tokenizer.next(&tag, &isEndTag)) {
+        if (isEndTag) {
+            // alternate links belong into the head, only look for <a> links if there are none
+            if (hasLinks && equalsIgnoringCase(tag.name, "head")) {
+                break;
+            }
+            continue;
+        }
+        if (tag.href.isEmpty()) {
+            continue;
+        }
+
+        if (equalsIgnoringCase(tag.name, "base")) {
+            baseUrl = url.resolved(QUrl(attributeValue(tag.href)));
+        } else if (equalsIgnoringCase(tag.name, "link")) {
+            const Rank rank = isFeedRelation(tag.rel) ? rankOfLinkType(tag.type) : NoFeed;
+            if (rank != NoFeed) {
+                const FeedCandidate candidate = {baseUrl.resolved(QUrl(attributeValue(tag.href))), attributeValue(tag.type), attributeValue(tag.title)};
+                ranked.append({candidate, rank});
+                hasLinks = true;
+            }
+        } else if (equalsIgnoringCase(tag.name, "a")) {
+            const QUrl link = baseUrl.resolved(QUrl(attributeValue(tag.href)));
+            if (looksLikeFeed(link)) {
+                const FeedCandidate candidate = {link, QString(), attributeValue(tag.title)};
+                ranked.append({candidate, link.host() == url.host() ? SameHostAnchor : OtherAnchor});
+            }
         }
-    } else {
-        discoveredFeedURL = QUrl(s2);
     }
 
-    return discoveredFeedURL;
+    std::stable_sort(ranked.begin(), ranked.end(), [](const RankedCandidate &lhs, const RankedCandidate &rhs) {
+        return lhs.rank < rhs.rank;
+    });
+
+    QList<FeedCandidate> candidates;
+    candidates.reserve(ranked.size());
+    QSet<QUrl> seen;
+    for (const RankedCandidate &r : std::as_const(ranked)) {
+        if (!seen.contains(r.candidate.url)) {
+            seen.insert(r.candidate.url);
+            candidates.append(r.candidate);
+        }
+    }
+    return candidates;
+}
+
+QUrl Syndication::LoaderUtil::parseFeed(const QByteArray &data, const QUrl &url)
+{
+#ifdef DEBUG_PARSING_FEED
+    qDebug() << " QUrl Syndication::LoaderUtil::parseFeed(const QByteArray &data, const QUrl &url)";
+    QFile headerFile(QStringLiteral("/tmp/bb.txt"));
+    headerFile.open(QIODevice::WriteOnly | QIODevice::Text);
+    QTextStream outHeaderStream(&headerFile);
+    outHeaderStream << data;
+    headerFile.close();
+#endif
+    const QList<FeedCandidate> candidates = feedCandidates(data, url);
+    return candidates.isEmpty() ? QUrl() : candidates.first().url;
 }
@@ -7,12 +7,24 @@
 
 #ifndef LOADERUTIL_H
 #define LOADERUTIL_H
+#include "loader.h"
 #include "syndication_private_export.h"
+#include <QList>
 #include <QUrl>
 namespace Syndication
 {
 namespace LoaderUtil
 {
+/*
+ * returns the feeds linked from the HTML page \a data, best candidates first:
+ * alternate <link>s to RSS first, then Atom, then RDF, each in document order,
+ * followed by <a> links to files that look like feeds, preferring those on
+ * the host of \a url.
+ * Relative links are resolved against \a url (or the page's <base>).
+ */
+Q_REQUIRED_RESULT SYNDICATION_TESTS_EXPORT QList<FeedCandidate> feedCandidates(const QByteArray &data, const QUrl &url);
+
+// returns the best of feedCandidates(), or an empty URL
 Q_REQUIRED_RESULT SYNDICATION_TESTS_EXPORT QUrl parseFeed(const QByteArray &data, const QUrl &url);
 }
 }
@@ -0,0 +1,39 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "categoryrss2streamimpl.h"
+
+#include <QString>
+
+namespace Syndication
+{
+CategoryRSS2StreamImpl::CategoryRSS2StreamImpl(const Syndication::RSS2::StreamCategory &category)
+    : m_category(category)
+{
+}
+
+bool CategoryRSS2StreamImpl::isNull() const
+{
+    return false;
+}
+
+QString CategoryRSS2StreamImpl::term() const
+{
+    return m_category.category;
+}
+
+QString CategoryRSS2StreamImpl::scheme() const
+{
+    return m_category.domain;
+}
+
+QString CategoryRSS2StreamImpl::label() const
+{
+    return QString();
+}
+
+} // namespace Syndication
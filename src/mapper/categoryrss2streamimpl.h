@@ -0,0 +1,41 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_CATEGORYRSS2STREAMIMPL_H
+#define SYNDICATION_MAPPER_CATEGORYRSS2STREAMIMPL_H
+
+#include <category.h>
+#include <rss2/streamdocument.h>
+
+namespace Syndication
+{
+class CategoryRSS2StreamImpl;
+typedef QSharedPointer<CategoryRSS2StreamImpl> CategoryRSS2StreamImplPtr;
+
+/*!
+ * \internal
+ */
+class CategoryRSS2StreamImpl : public Syndication::Category
+{
+public:
+    explicit CategoryRSS2StreamImpl(const Syndication::RSS2::StreamCategory &category);
+
+    Q_REQUIRED_RESULT bool isNull() const override;
+
+    Q_REQUIRED_RESULT QString term() const override;
+
+    Q_REQUIRED_RESULT QString scheme() const override;
+
+    Q_REQUIRED_RESULT QString label() const override;
+
+private:
+    Syndication::RSS2::StreamCategory m_category;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_CATEGORYRSS2STREAMIMPL_H
@@ -0,0 +1,40 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "categorysnapshotimpl.h"
+
+#include <QString>
+
+namespace Syndication
+{
+CategorySnapshotImpl::CategorySnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot, const Syndication::Snapshot::Category &category)
+    : m_snapshot(snapshot)
+    , m_category(category)
+{
+}
+
+bool CategorySnapshotImpl::isNull() const
+{
+    return m_category.term == 0 && m_category.scheme == 0 && m_category.label == 0;
+}
+
+QString CategorySnapshotImpl::term() const
+{
+    return m_snapshot->string(m_category.term);
+}
+
+QString CategorySnapshotImpl::scheme() const
+{
+    return m_snapshot->string(m_category.scheme);
+}
+
+QString CategorySnapshotImpl::label() const
+{
+    return m_snapshot->string(m_category.label);
+}
+
+} // namespace Syndication
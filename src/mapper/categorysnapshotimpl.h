@@ -0,0 +1,42 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_CATEGORYSNAPSHOTIMPL_H
+#define SYNDICATION_MAPPER_CATEGORYSNAPSHOTIMPL_H
+
+#include <category.h>
+#include <feedsnapshot_p.h>
+
+namespace Syndication
+{
+class CategorySnapshotImpl;
+typedef QSharedPointer<CategorySnapshotImpl> CategorySnapshotImplPtr;
+
+/*!
+ * \internal
+ */
+class CategorySnapshotImpl : public Syndication::Category
+{
+public:
+    CategorySnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot, const Syndication::Snapshot::Category &category);
+
+    Q_REQUIRED_RESULT bool isNull() const override;
+
+    Q_REQUIRED_RESULT QString term() const override;
+
+    Q_REQUIRED_RESULT QString scheme() const override;
+
+    Q_REQUIRED_RESULT QString label() const override;
+
+private:
+    Syndication::FeedSnapshotPrivatePtr m_snapshot;
+    Syndication::Snapshot::Category m_category;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_CATEGORYSNAPSHOTIMPL_H
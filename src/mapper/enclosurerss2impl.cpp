@@ -47,8 +47,11 @@ uint EnclosureRSS2Impl::length() const
 
 uint EnclosureRSS2Impl::duration() const
 {
-    QString durStr = m_item.extractElementTextNS(itunesNamespace(), QStringLiteral("duration"));
+    return parseDuration(m_item.extractElementTextNS(itunesNamespace(), QStringLiteral("duration")));
+}
 
+uint EnclosureRSS2Impl::parseDuration(const QString &durStr)
+{
     if (durStr.isEmpty()) {
         return 0;
     }
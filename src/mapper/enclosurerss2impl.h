@@ -34,6 +34,12 @@ public:
 
     Q_REQUIRED_RESULT uint duration() const override;
 
+    /*!
+     * parses an itunes:duration value ("h:m:s", "m:s" or seconds)
+     * Returns the duration in seconds, or 0 if \a str cannot be parsed
+     */
+    Q_REQUIRED_RESULT static uint parseDuration(const QString &str);
+
 private:
     Syndication::RSS2::Item m_item;
     Syndication::RSS2::Enclosure m_enclosure;
@@ -0,0 +1,52 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "enclosurerss2streamimpl.h"
+#include "enclosurerss2impl.h"
+
+#include <QString>
+
+namespace Syndication
+{
+EnclosureRSS2StreamImpl::EnclosureRSS2StreamImpl(const Syndication::RSS2::StreamEnclosure &enclosure, const QString &duration)
+    : m_enclosure(enclosure)
+    , m_duration(duration)
+{
+}
+
+bool EnclosureRSS2StreamImpl::isNull() const
+{
+    return false;
+}
+
+QString EnclosureRSS2StreamImpl::url() const
+{
+    return m_enclosure.url;
+}
+
+QString EnclosureRSS2StreamImpl::title() const
+{
+    // RSS2 enclosures have no title
+    return QString();
+}
+
+QString EnclosureRSS2StreamImpl::type() const
+{
+    return m_enclosure.type;
+}
+
+uint EnclosureRSS2StreamImpl::length() const
+{
+    return m_enclosure.length;
+}
+
+uint EnclosureRSS2StreamImpl::duration() const
+{
+    return EnclosureRSS2Impl::parseDuration(m_duration);
+}
+
+} // namespace Syndication
@@ -0,0 +1,50 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_ENCLOSURERSS2STREAMIMPL_H
+#define SYNDICATION_MAPPER_ENCLOSURERSS2STREAMIMPL_H
+
+#include <enclosure.h>
+#include <rss2/streamdocument.h>
+
+namespace Syndication
+{
+class EnclosureRSS2StreamImpl;
+typedef QSharedPointer<EnclosureRSS2StreamImpl> EnclosureRSS2StreamImplPtr;
+
+/*!
+ * \internal
+ */
+class EnclosureRSS2StreamImpl : public Syndication::Enclosure
+{
+public:
+    /*!
+     * \a enclosure the enclosure attributes
+     * \a duration the itunes:duration value of the item
+     */
+    EnclosureRSS2StreamImpl(const Syndication::RSS2::StreamEnclosure &enclosure, const QString &duration);
+
+    Q_REQUIRED_RESULT bool isNull() const override;
+
+    Q_REQUIRED_RESULT QString url() const override;
+
+    Q_REQUIRED_RESULT QString title() const override;
+
+    Q_REQUIRED_RESULT QString type() const override;
+
+    Q_REQUIRED_RESULT uint length() const override;
+
+    Q_REQUIRED_RESULT uint duration() const override;
+
+private:
+    Syndication::RSS2::StreamEnclosure m_enclosure;
+    QString m_duration;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_ENCLOSURERSS2STREAMIMPL_H
@@ -0,0 +1,50 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "enclosuresnapshotimpl.h"
+
+#include <QString>
+
+namespace Syndication
+{
+EnclosureSnapshotImpl::EnclosureSnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot, const Syndication::Snapshot::Enclosure &enclosure)
+    : m_snapshot(snapshot)
+    , m_enclosure(enclosure)
+{
+}
+
+bool EnclosureSnapshotImpl::isNull() const
+{
+    return m_enclosure.url == 0;
+}
+
+QString EnclosureSnapshotImpl::url() const
+{
+    return m_snapshot->string(m_enclosure.url);
+}
+
+QString EnclosureSnapshotImpl::title() const
+{
+    return m_snapshot->string(m_enclosure.title);
+}
+
+QString EnclosureSnapshotImpl::type() const
+{
+    return m_snapshot->string(m_enclosure.type);
+}
+
+uint EnclosureSnapshotImpl::length() const
+{
+    return m_enclosure.length;
+}
+
+uint EnclosureSnapshotImpl::duration() const
+{
+    return m_enclosure.duration;
+}
+
+} // namespace Syndication
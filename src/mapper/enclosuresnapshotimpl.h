@@ -0,0 +1,46 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_ENCLOSURESNAPSHOTIMPL_H
+#define SYNDICATION_MAPPER_ENCLOSURESNAPSHOTIMPL_H
+
+#include <enclosure.h>
+#include <feedsnapshot_p.h>
+
+namespace Syndication
+{
+class EnclosureSnapshotImpl;
+typedef QSharedPointer<EnclosureSnapshotImpl> EnclosureSnapshotImplPtr;
+
+/*!
+ * \internal
+ */
+class EnclosureSnapshotImpl : public Syndication::Enclosure
+{
+public:
+    EnclosureSnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot, const Syndication::Snapshot::Enclosure &enclosure);
+
+    Q_REQUIRED_RESULT bool isNull() const override;
+
+    Q_REQUIRED_RESULT QString url() const override;
+
+    Q_REQUIRED_RESULT QString title() const override;
+
+    Q_REQUIRED_RESULT QString type() const override;
+
+    Q_REQUIRED_RESULT uint length() const override;
+
+    Q_REQUIRED_RESULT uint duration() const override;
+
+private:
+    Syndication::FeedSnapshotPrivatePtr m_snapshot;
+    Syndication::Snapshot::Enclosure m_enclosure;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_ENCLOSURESNAPSHOTIMPL_H
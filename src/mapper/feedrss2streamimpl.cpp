@@ -0,0 +1,111 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "feedrss2streamimpl.h"
+#include "categoryrss2streamimpl.h"
+#include "imagerss2streamimpl.h"
+#include "itemrss2streamimpl.h"
+
+#include <personimpl.h>
+
+#include <QDomElement>
+#include <QList>
+#include <QMultiMap>
+#include <QString>
+
+namespace Syndication
+{
+FeedRSS2StreamImpl::FeedRSS2StreamImpl(Syndication::RSS2::StreamDocumentPtr doc)
+    : m_doc(doc)
+{
+}
+
+Syndication::SpecificDocumentPtr FeedRSS2StreamImpl::specificDocument() const
+{
+    return m_doc;
+}
+
+QList<Syndication::ItemPtr> FeedRSS2StreamImpl::items() const
+{
+    const int count = m_doc->items().count();
+
+    QList<ItemPtr> items;
+    items.reserve(count);
+
+    for (int i = 0; i < count; ++i) {
+        items.append(ItemRSS2StreamImplPtr(new ItemRSS2StreamImpl(m_doc, i)));
+    }
+
+    return items;
+}
+
+QList<Syndication::CategoryPtr> FeedRSS2StreamImpl::categories() const
+{
+    const QList<Syndication::RSS2::StreamCategory> &entries = m_doc->channel().categories;
+
+    QList<CategoryPtr> categories;
+    categories.reserve(entries.count());
+
+    std::transform(entries.cbegin(), entries.cend(), std::back_inserter(categories), [](const Syndication::RSS2::StreamCategory &entry) {
+        return CategoryRSS2StreamImplPtr(new CategoryRSS2StreamImpl(entry));
+    });
+
+    return categories;
+}
+
+QString FeedRSS2StreamImpl::title() const
+{
+    return m_doc->channel().title;
+}
+
+QString FeedRSS2StreamImpl::link() const
+{
+    return m_doc->channel().link;
+}
+
+QString FeedRSS2StreamImpl::description() const
+{
+    return m_doc->channel().description;
+}
+
+QList<PersonPtr> FeedRSS2StreamImpl::authors() const
+{
+    return QList<PersonPtr>();
+}
+
+QString FeedRSS2StreamImpl::language() const
+{
+    return m_doc->channel().language;
+}
+
+QString FeedRSS2StreamImpl::copyright() const
+{
+    return m_doc->channel().copyright;
+}
+
+ImagePtr FeedRSS2StreamImpl::image() const
+{
+    return ImageRSS2StreamImplPtr(new ImageRSS2StreamImpl(m_doc->channel().image));
+}
+
+ImagePtr FeedRSS2StreamImpl::icon() const
+{
+    return ImageRSS2StreamImplPtr(new ImageRSS2StreamImpl({}));
+}
+
+QMultiMap<QString, QDomElement> FeedRSS2StreamImpl::additionalProperties() const
+{
+    QMultiMap<QString, QDomElement> ret;
+
+    for (const Syndication::RSS2::StreamElement &i : m_doc->channel().unhandled) {
+        ret.insert(i.key, i.toElement());
+    }
+
+    return ret;
+}
+
+} // namespace Syndication
@@ -0,0 +1,60 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_FEEDRSS2STREAMIMPL_H
+#define SYNDICATION_MAPPER_FEEDRSS2STREAMIMPL_H
+
+#include <feed.h>
+#include <rss2/streamdocument.h>
+
+namespace Syndication
+{
+class FeedRSS2StreamImpl;
+typedef QSharedPointer<FeedRSS2StreamImpl> FeedRSS2StreamImplPtr;
+class Image;
+typedef QSharedPointer<Image> ImagePtr;
+
+/*!
+ * \internal
+ * Feed implementation for documents read by RSS2::StreamParser.
+ */
+class FeedRSS2StreamImpl : public Syndication::Feed
+{
+public:
+    explicit FeedRSS2StreamImpl(Syndication::RSS2::StreamDocumentPtr doc);
+
+    Syndication::SpecificDocumentPtr specificDocument() const override;
+
+    QList<ItemPtr> items() const override;
+
+    QList<CategoryPtr> categories() const override;
+
+    QString title() const override;
+
+    QString link() const override;
+
+    QString description() const override;
+
+    QList<PersonPtr> authors() const override;
+
+    QString language() const override;
+
+    QString copyright() const override;
+
+    ImagePtr image() const override;
+
+    ImagePtr icon() const override;
+
+    QMultiMap<QString, QDomElement> additionalProperties() const override;
+
+private:
+    Syndication::RSS2::StreamDocumentPtr m_doc;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_FEEDRSS2STREAMIMPL_H
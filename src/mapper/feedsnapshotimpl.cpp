@@ -0,0 +1,127 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "feedsnapshotimpl.h"
+#include "categorysnapshotimpl.h"
+#include "imagesnapshotimpl.h"
+#include "itemsnapshotimpl.h"
+
+#include <personimpl.h>
+#include <specificdocument.h>
+
+#include <QDomElement>
+#include <QList>
+#include <QMultiMap>
+#include <QString>
+
+namespace Syndication
+{
+FeedSnapshotImpl::FeedSnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot)
+    : m_snapshot(snapshot)
+{
+}
+
+Syndication::SpecificDocumentPtr FeedSnapshotImpl::specificDocument() const
+{
+    // the format-specific document is not part of the snapshot
+    return Syndication::SpecificDocumentPtr();
+}
+
+QList<Syndication::ItemPtr> FeedSnapshotImpl::items() const
+{
+    const quint32 count = m_snapshot->items.size;
+
+    QList<ItemPtr> items;
+    items.reserve(count);
+
+    for (quint32 i = 0; i < count; ++i) {
+        items.append(ItemSnapshotImplPtr(new ItemSnapshotImpl(m_snapshot, i)));
+    }
+
+    return items;
+}
+
+QList<Syndication::CategoryPtr> FeedSnapshotImpl::categories() const
+{
+    return categoriesOf(m_snapshot, m_snapshot->channel->categories);
+}
+
+QString FeedSnapshotImpl::title() const
+{
+    return m_snapshot->string(m_snapshot->channel->title);
+}
+
+QString FeedSnapshotImpl::link() const
+{
+    return m_snapshot->string(m_snapshot->channel->link);
+}
+
+QString FeedSnapshotImpl::description() const
+{
+    return m_snapshot->string(m_snapshot->channel->description);
+}
+
+QList<PersonPtr> FeedSnapshotImpl::authors() const
+{
+    return personsOf(m_snapshot, m_snapshot->channel->authors);
+}
+
+QString FeedSnapshotImpl::language() const
+{
+    return m_snapshot->string(m_snapshot->channel->language);
+}
+
+QString FeedSnapshotImpl::copyright() const
+{
+    return m_snapshot->string(m_snapshot->channel->copyright);
+}
+
+ImagePtr FeedSnapshotImpl::image() const
+{
+    return ImageSnapshotImplPtr(new ImageSnapshotImpl(m_snapshot, m_snapshot->channel->image));
+}
+
+ImagePtr FeedSnapshotImpl::icon() const
+{
+    return ImageSnapshotImplPtr(new ImageSnapshotImpl(m_snapshot, m_snapshot->channel->icon));
+}
+
+QMultiMap<QString, QDomElement> FeedSnapshotImpl::additionalProperties() const
+{
+    return m_snapshot->elements(m_snapshot->channel->properties);
+}
+
+QList<PersonPtr> FeedSnapshotImpl::personsOf(const Syndication::FeedSnapshotPrivatePtr &snapshot, Syndication::Snapshot::Range range)
+{
+    range = FeedSnapshotPrivate::bounded(range, snapshot->persons.size);
+
+    QList<PersonPtr> list;
+    list.reserve(range.count);
+
+    for (quint32 i = range.first; i < range.first + range.count; ++i) {
+        const Syndication::Snapshot::Person &person = snapshot->persons[i];
+        list.append(PersonImplPtr(new PersonImpl(snapshot->string(person.name), snapshot->string(person.uri), snapshot->string(person.email))));
+    }
+
+    return list;
+}
+
+QList<CategoryPtr> FeedSnapshotImpl::categoriesOf(const Syndication::FeedSnapshotPrivatePtr &snapshot, Syndication::Snapshot::Range range)
+{
+    range = FeedSnapshotPrivate::bounded(range, snapshot->categories.size);
+
+    QList<CategoryPtr> list;
+    list.reserve(range.count);
+
+    for (quint32 i = range.first; i < range.first + range.count; ++i) {
+        list.append(CategorySnapshotImplPtr(new CategorySnapshotImpl(snapshot, snapshot->categories[i])));
+    }
+
+    return list;
+}
+
+} // namespace Syndication
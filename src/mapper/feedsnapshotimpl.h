@@ -0,0 +1,70 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_FEEDSNAPSHOTIMPL_H
+#define SYNDICATION_MAPPER_FEEDSNAPSHOTIMPL_H
+
+#include <feed.h>
+#include <feedsnapshot_p.h>
+
+namespace Syndication
+{
+class FeedSnapshotImpl;
+typedef QSharedPointer<FeedSnapshotImpl> FeedSnapshotImplPtr;
+class Image;
+typedef QSharedPointer<Image> ImagePtr;
+
+/*!
+ * \internal
+ * Feed implementation reading the data of a FeedSnapshot.
+ */
+class FeedSnapshotImpl : public Syndication::Feed
+{
+public:
+    explicit FeedSnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot);
+
+    Syndication::SpecificDocumentPtr specificDocument() const override;
+
+    QList<ItemPtr> items() const override;
+
+    QList<CategoryPtr> categories() const override;
+
+    QString title() const override;
+
+    QString link() const override;
+
+    QString description() const override;
+
+    QList<PersonPtr> authors() const override;
+
+    QString language() const override;
+
+    QString copyright() const override;
+
+    ImagePtr image() const override;
+
+    ImagePtr icon() const override;
+
+    QMultiMap<QString, QDomElement> additionalProperties() const override;
+
+    /*!
+     * returns the persons in \a range of \a snapshot
+     */
+    static QList<PersonPtr> personsOf(const Syndication::FeedSnapshotPrivatePtr &snapshot, Syndication::Snapshot::Range range);
+
+    /*!
+     * returns the categories in \a range of \a snapshot
+     */
+    static QList<CategoryPtr> categoriesOf(const Syndication::FeedSnapshotPrivatePtr &snapshot, Syndication::Snapshot::Range range);
+
+private:
+    Syndication::FeedSnapshotPrivatePtr m_snapshot;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_FEEDSNAPSHOTIMPL_H
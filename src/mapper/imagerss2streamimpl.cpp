@@ -0,0 +1,54 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "imagerss2streamimpl.h"
+
+#include <QString>
+
+namespace Syndication
+{
+ImageRSS2StreamImpl::ImageRSS2StreamImpl(const Syndication::RSS2::StreamImage &image)
+    : m_image(image)
+{
+}
+
+bool ImageRSS2StreamImpl::isNull() const
+{
+    return m_image.isNull;
+}
+
+QString ImageRSS2StreamImpl::url() const
+{
+    return m_image.url;
+}
+
+QString ImageRSS2StreamImpl::title() const
+{
+    return m_image.title;
+}
+
+QString ImageRSS2StreamImpl::link() const
+{
+    return m_image.link;
+}
+
+QString ImageRSS2StreamImpl::description() const
+{
+    return m_image.description;
+}
+
+uint ImageRSS2StreamImpl::height() const
+{
+    return m_image.height;
+}
+
+uint ImageRSS2StreamImpl::width() const
+{
+    return m_image.width;
+}
+
+} // namespace Syndication
@@ -0,0 +1,47 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_IMAGERSS2STREAMIMPL_H
+#define SYNDICATION_MAPPER_IMAGERSS2STREAMIMPL_H
+
+#include <image.h>
+#include <rss2/streamdocument.h>
+
+namespace Syndication
+{
+class ImageRSS2StreamImpl;
+typedef QSharedPointer<ImageRSS2StreamImpl> ImageRSS2StreamImplPtr;
+
+/*!
+ * \internal
+ */
+class ImageRSS2StreamImpl : public Syndication::Image
+{
+public:
+    explicit ImageRSS2StreamImpl(const Syndication::RSS2::StreamImage &image);
+
+    Q_REQUIRED_RESULT bool isNull() const override;
+
+    Q_REQUIRED_RESULT QString url() const override;
+
+    Q_REQUIRED_RESULT QString title() const override;
+
+    Q_REQUIRED_RESULT QString link() const override;
+
+    Q_REQUIRED_RESULT QString description() const override;
+
+    Q_REQUIRED_RESULT uint width() const override;
+
+    Q_REQUIRED_RESULT uint height() const override;
+
+private:
+    Syndication::RSS2::StreamImage m_image;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_IMAGERSS2STREAMIMPL_H
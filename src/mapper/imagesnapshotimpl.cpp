@@ -0,0 +1,55 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "imagesnapshotimpl.h"
+
+#include <QString>
+
+namespace Syndication
+{
+ImageSnapshotImpl::ImageSnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot, const Syndication::Snapshot::Image &image)
+    : m_snapshot(snapshot)
+    , m_image(image)
+{
+}
+
+bool ImageSnapshotImpl::isNull() const
+{
+    return m_image.isNull != 0;
+}
+
+QString ImageSnapshotImpl::url() const
+{
+    return m_snapshot->string(m_image.url);
+}
+
+QString ImageSnapshotImpl::title() const
+{
+    return m_snapshot->string(m_image.title);
+}
+
+QString ImageSnapshotImpl::link() const
+{
+    return m_snapshot->string(m_image.link);
+}
+
+QString ImageSnapshotImpl::description() const
+{
+    return m_snapshot->string(m_image.description);
+}
+
+uint ImageSnapshotImpl::width() const
+{
+    return m_image.width;
+}
+
+uint ImageSnapshotImpl::height() const
+{
+    return m_image.height;
+}
+
+} // namespace Syndication
@@ -0,0 +1,48 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_IMAGESNAPSHOTIMPL_H
+#define SYNDICATION_MAPPER_IMAGESNAPSHOTIMPL_H
+
+#include <feedsnapshot_p.h>
+#include <image.h>
+
+namespace Syndication
+{
+class ImageSnapshotImpl;
+typedef QSharedPointer<ImageSnapshotImpl> ImageSnapshotImplPtr;
+
+/*!
+ * \internal
+ */
+class ImageSnapshotImpl : public Syndication::Image
+{
+public:
+    ImageSnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot, const Syndication::Snapshot::Image &image);
+
+    Q_REQUIRED_RESULT bool isNull() const override;
+
+    Q_REQUIRED_RESULT QString url() const override;
+
+    Q_REQUIRED_RESULT QString title() const override;
+
+    Q_REQUIRED_RESULT QString link() const override;
+
+    Q_REQUIRED_RESULT QString description() const override;
+
+    Q_REQUIRED_RESULT uint width() const override;
+
+    Q_REQUIRED_RESULT uint height() const override;
+
+private:
+    Syndication::FeedSnapshotPrivatePtr m_snapshot;
+    Syndication::Snapshot::Image m_image;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_IMAGESNAPSHOTIMPL_H
@@ -24,6 +24,8 @@ namespace Syndication
 ItemRSS2Impl::ItemRSS2Impl(const Syndication::RSS2::Item &item)
     : m_item(item)
 {
+    // most accessors are used when mapping, read the fields in one go
+    m_item.materialize();
 }
 
 QString ItemRSS2Impl::title() const
@@ -0,0 +1,166 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "itemrss2streamimpl.h"
+#include "categoryrss2streamimpl.h"
+#include "enclosurerss2streamimpl.h"
+
+#include <personimpl.h>
+#include <tools.h>
+
+#include <QDomElement>
+#include <QList>
+#include <QMultiMap>
+#include <QString>
+
+namespace Syndication
+{
+ItemRSS2StreamImpl::ItemRSS2StreamImpl(Syndication::RSS2::StreamDocumentPtr doc, int index)
+    : m_doc(doc)
+    , m_index(index)
+{
+}
+
+const Syndication::RSS2::ItemRecord &ItemRSS2StreamImpl::record() const
+{
+    return m_doc->items().at(m_index);
+}
+
+QString ItemRSS2StreamImpl::title() const
+{
+    return record().title;
+}
+
+QString ItemRSS2StreamImpl::link() const
+{
+    const Syndication::RSS2::ItemRecord &item = record();
+    if (!item.link.isEmpty()) {
+        return item.link;
+    }
+
+    if (item.guidIsPermaLink) {
+        return item.guid;
+    }
+
+    return QString();
+}
+
+QString ItemRSS2StreamImpl::description() const
+{
+    return record().description;
+}
+
+QString ItemRSS2StreamImpl::content() const
+{
+    return record().content;
+}
+
+QList<PersonPtr> ItemRSS2StreamImpl::authors() const
+{
+    QList<PersonPtr> list;
+
+    PersonPtr ptr = personFromString(record().author);
+
+    if (!ptr->isNull()) {
+        list.append(ptr);
+    }
+
+    return list;
+}
+
+QString ItemRSS2StreamImpl::language() const
+{
+    return QString();
+}
+
+QString ItemRSS2StreamImpl::id() const
+{
+    const QString guid = record().guid;
+    if (!guid.isEmpty()) {
+        return guid;
+    }
+
+    return QStringLiteral("hash:%1").arg(calcMD5Sum(title() + description() + link() + content()));
+}
+
+time_t ItemRSS2StreamImpl::datePublished() const
+{
+    return record().pubDate;
+}
+
+time_t ItemRSS2StreamImpl::dateUpdated() const
+{
+    return record().updated;
+}
+
+QList<Syndication::EnclosurePtr> ItemRSS2StreamImpl::enclosures() const
+{
+    const Syndication::RSS2::ItemRecord &item = record();
+
+    QList<Syndication::EnclosurePtr> list;
+    list.reserve(item.enclosures.size());
+
+    std::transform(item.enclosures.cbegin(), item.enclosures.cend(), std::back_inserter(list), [&item](const Syndication::RSS2::StreamEnclosure &e) {
+        return EnclosureRSS2StreamImplPtr(new EnclosureRSS2StreamImpl(e, item.duration));
+    });
+
+    return list;
+}
+
+QList<Syndication::CategoryPtr> ItemRSS2StreamImpl::categories() const
+{
+    const QList<Syndication::RSS2::StreamCategory> &cats = record().categories;
+
+    QList<Syndication::CategoryPtr> list;
+    list.reserve(cats.size());
+
+    std::transform(cats.cbegin(), cats.cend(), std::back_inserter(list), [](const Syndication::RSS2::StreamCategory &c) {
+        return CategoryRSS2StreamImplPtr(new CategoryRSS2StreamImpl(c));
+    });
+
+    return list;
+}
+
+int ItemRSS2StreamImpl::commentsCount() const
+{
+    bool ok = false;
+    int comments = record().slashComments.toInt(&ok);
+    return ok ? comments : -1;
+}
+
+QString ItemRSS2StreamImpl::commentsLink() const
+{
+    return record().comments;
+}
+
+QString ItemRSS2StreamImpl::commentsFeed() const
+{
+    return record().commentRss;
+}
+
+QString ItemRSS2StreamImpl::commentPostUri() const
+{
+    return record().commentPostUri;
+}
+
+Syndication::SpecificItemPtr ItemRSS2StreamImpl::specificItem() const
+{
+    return Syndication::SpecificItemPtr(new Syndication::RSS2::StreamItem(m_doc, m_index));
+}
+
+QMultiMap<QString, QDomElement> ItemRSS2StreamImpl::additionalProperties() const
+{
+    QMultiMap<QString, QDomElement> ret;
+
+    for (const Syndication::RSS2::StreamElement &i : record().unhandled) {
+        ret.insert(i.key, i.toElement());
+    }
+
+    return ret;
+}
+
+} // namespace Syndication
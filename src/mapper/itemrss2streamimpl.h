@@ -0,0 +1,75 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_ITEMRSS2STREAMIMPL_H
+#define SYNDICATION_MAPPER_ITEMRSS2STREAMIMPL_H
+
+#include <item.h>
+#include <rss2/streamdocument.h>
+
+namespace Syndication
+{
+class ItemRSS2StreamImpl;
+typedef QSharedPointer<ItemRSS2StreamImpl> ItemRSS2StreamImplPtr;
+
+/*!
+ * \internal
+ * Item implementation for an item record read by RSS2::StreamParser.
+ */
+class ItemRSS2StreamImpl : public Syndication::Item
+{
+public:
+    /*!
+     * \a doc the streamed document
+     * \a index position of the item in the document
+     */
+    ItemRSS2StreamImpl(Syndication::RSS2::StreamDocumentPtr doc, int index);
+
+    QString title() const override;
+
+    QString link() const override;
+
+    QString description() const override;
+
+    QString content() const override;
+
+    QList<PersonPtr> authors() const override;
+
+    QString language() const override;
+
+    QString id() const override;
+
+    time_t datePublished() const override;
+
+    time_t dateUpdated() const override;
+
+    QList<EnclosurePtr> enclosures() const override;
+
+    QList<CategoryPtr> categories() const override;
+
+    SpecificItemPtr specificItem() const override;
+
+    int commentsCount() const override;
+
+    QString commentsLink() const override;
+
+    QString commentsFeed() const override;
+
+    QString commentPostUri() const override;
+
+    QMultiMap<QString, QDomElement> additionalProperties() const override;
+
+private:
+    const Syndication::RSS2::ItemRecord &record() const;
+
+    Syndication::RSS2::StreamDocumentPtr m_doc;
+    int m_index;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_ITEMRSS2STREAMIMPL_H
@@ -0,0 +1,127 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "itemsnapshotimpl.h"
+#include "enclosuresnapshotimpl.h"
+#include "feedsnapshotimpl.h"
+
+#include <specificitem.h>
+
+#include <QDomElement>
+#include <QList>
+#include <QMultiMap>
+#include <QString>
+
+namespace Syndication
+{
+ItemSnapshotImpl::ItemSnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot, quint32 index)
+    : m_snapshot(snapshot)
+    , m_index(index)
+{
+}
+
+const Syndication::Snapshot::Item &ItemSnapshotImpl::record() const
+{
+    return m_snapshot->items[m_index];
+}
+
+QString ItemSnapshotImpl::title() const
+{
+    return m_snapshot->string(record().title);
+}
+
+QString ItemSnapshotImpl::link() const
+{
+    return m_snapshot->string(record().link);
+}
+
+QString ItemSnapshotImpl::description() const
+{
+    return m_snapshot->string(record().description);
+}
+
+QString ItemSnapshotImpl::content() const
+{
+    return m_snapshot->string(record().content);
+}
+
+QList<PersonPtr> ItemSnapshotImpl::authors() const
+{
+    return FeedSnapshotImpl::personsOf(m_snapshot, record().authors);
+}
+
+QString ItemSnapshotImpl::language() const
+{
+    return m_snapshot->string(record().language);
+}
+
+QString ItemSnapshotImpl::id() const
+{
+    return m_snapshot->string(record().id);
+}
+
+time_t ItemSnapshotImpl::datePublished() const
+{
+    return record().datePublished;
+}
+
+time_t ItemSnapshotImpl::dateUpdated() const
+{
+    return record().dateUpdated;
+}
+
+QList<Syndication::EnclosurePtr> ItemSnapshotImpl::enclosures() const
+{
+    const Syndication::Snapshot::Range range = FeedSnapshotPrivate::bounded(record().enclosures, m_snapshot->enclosures.size);
+
+    QList<Syndication::EnclosurePtr> list;
+    list.reserve(range.count);
+
+    for (quint32 i = range.first; i < range.first + range.count; ++i) {
+        list.append(EnclosureSnapshotImplPtr(new EnclosureSnapshotImpl(m_snapshot, m_snapshot->enclosures[i])));
+    }
+
+    return list;
+}
+
+QList<Syndication::CategoryPtr> ItemSnapshotImpl::categories() const
+{
+    return FeedSnapshotImpl::categoriesOf(m_snapshot, record().categories);
+}
+
+int ItemSnapshotImpl::commentsCount() const
+{
+    return record().commentsCount;
+}
+
+QString ItemSnapshotImpl::commentsLink() const
+{
+    return m_snapshot->string(record().commentsLink);
+}
+
+QString ItemSnapshotImpl::commentsFeed() const
+{
+    return m_snapshot->string(record().commentsFeed);
+}
+
+QString ItemSnapshotImpl::commentPostUri() const
+{
+    return m_snapshot->string(record().commentPostUri);
+}
+
+Syndication::SpecificItemPtr ItemSnapshotImpl::specificItem() const
+{
+    // the format-specific item is not part of the snapshot
+    return Syndication::SpecificItemPtr();
+}
+
+QMultiMap<QString, QDomElement> ItemSnapshotImpl::additionalProperties() const
+{
+    return m_snapshot->elements(record().properties);
+}
+
+} // namespace Syndication
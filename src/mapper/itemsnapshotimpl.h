@@ -0,0 +1,75 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPER_ITEMSNAPSHOTIMPL_H
+#define SYNDICATION_MAPPER_ITEMSNAPSHOTIMPL_H
+
+#include <feedsnapshot_p.h>
+#include <item.h>
+
+namespace Syndication
+{
+class ItemSnapshotImpl;
+typedef QSharedPointer<ItemSnapshotImpl> ItemSnapshotImplPtr;
+
+/*!
+ * \internal
+ * Item implementation for an item record of a FeedSnapshot.
+ */
+class ItemSnapshotImpl : public Syndication::Item
+{
+public:
+    /*!
+     * \a snapshot the snapshot data
+     * \a index position of the item in the snapshot
+     */
+    ItemSnapshotImpl(Syndication::FeedSnapshotPrivatePtr snapshot, quint32 index);
+
+    QString title() const override;
+
+    QString link() const override;
+
+    QString description() const override;
+
+    QString content() const override;
+
+    QList<PersonPtr> authors() const override;
+
+    QString language() const override;
+
+    QString id() const override;
+
+    time_t datePublished() const override;
+
+    time_t dateUpdated() const override;
+
+    QList<EnclosurePtr> enclosures() const override;
+
+    QList<CategoryPtr> categories() const override;
+
+    SpecificItemPtr specificItem() const override;
+
+    int commentsCount() const override;
+
+    QString commentsLink() const override;
+
+    QString commentsFeed() const override;
+
+    QString commentPostUri() const override;
+
+    QMultiMap<QString, QDomElement> additionalProperties() const override;
+
+private:
+    const Syndication::Snapshot::Item &record() const;
+
+    Syndication::FeedSnapshotPrivatePtr m_snapshot;
+    quint32 m_index;
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPER_ITEMSNAPSHOTIMPL_H
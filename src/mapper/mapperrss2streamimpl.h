@@ -0,0 +1,33 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_MAPPERRSS2STREAMIMPL_H
+#define SYNDICATION_MAPPERRSS2STREAMIMPL_H
+
+#include "feedrss2streamimpl.h"
+
+#include <feed.h>
+#include <mapper.h>
+#include <rss2/streamdocument.h>
+#include <specificdocument.h>
+
+namespace Syndication
+{
+/*!
+ * \internal
+ */
+class RSS2StreamMapper : public Mapper<Feed>
+{
+    QSharedPointer<Feed> map(SpecificDocumentPtr doc) const override
+    {
+        return QSharedPointer<Feed>(new FeedRSS2StreamImpl(doc.staticCast<RSS2::StreamDocument>()));
+    }
+};
+
+} // namespace Syndication
+
+#endif // SYNDICATION_MAPPERRSS2STREAMIMPL_H
@@ -16,8 +16,12 @@
 #include <syndication/parsercollection.h>
 #include <syndication/specificdocument.h>
 
+#include "documentsniffer_p.h"
+#include "instrumentation_p.h"
+
 #include <QDomDocument>
 #include <QHash>
+#include <QList>
 #include <QString>
 
 namespace Syndication
@@ -36,12 +40,24 @@ public:
 
     QSharedPointer<T> parse(const DocumentSource &source, const QString &formatHint = QString()) override;
 
+    // reentrant variant of parse(): does not touch lastError(), but stores
+    // the result in *error instead, and the format of the parser used in
+    // *format if given. Safe to call from several threads at once as long as
+    // no parsers or mappers are registered or changed meanwhile and each
+    // thread uses its own DocumentSource.
+    QSharedPointer<T> parse(const DocumentSource &source, const QString &formatHint, ErrorCode *error, QString *format = nullptr) const;
+
     bool registerParser(AbstractParser *parser, Mapper<T> *mapper) override;
 
     void changeMapper(const QString &format, Mapper<T> *mapper) override;
 
     ErrorCode lastError() const override;
 
+    // the parser and mapper registered for format, or nullptr. Lets the
+    // stage benchmark run the steps of parse() one by one.
+    const AbstractParser *parser(const QString &format) const;
+    const Mapper<T> *mapper(const QString &format) const;
+
 private:
     ParserCollectionImpl(const ParserCollectionImpl &);
     ParserCollectionImpl &operator=(const ParserCollectionImpl &);
@@ -89,38 +105,73 @@ void ParserCollectionImpl<T>::changeMapper(const QString &format, Mapper<T> *map
 template<class T>
 QSharedPointer<T> ParserCollectionImpl<T>::parse(const DocumentSource &source, const QString &formatHint)
 {
-    m_lastError = Syndication::Success;
-
-    if (!formatHint.isNull() && m_parsers.contains(formatHint)) {
-        if (m_parsers[formatHint]->accept(source)) {
-            SpecificDocumentPtr doc = m_parsers[formatHint]->parse(source);
-            if (!doc->isValid()) {
-                m_lastError = InvalidFormat;
-                return FeedPtr();
-            }
+    return parse(source, formatHint, &m_lastError);
+}
+
+template<class T>
+QSharedPointer<T> ParserCollectionImpl<T>::parse(const DocumentSource &source, const QString &formatHint, ErrorCode *error, QString *format) const
+{
+    *error = Syndication::Success;
+    if (format) {
+        format->clear();
+    }
 
-            return m_mappers[formatHint]->map(doc);
+    const StageTimer accepting;
+    const AbstractParser *parser = nullptr;
+    if (!formatHint.isNull()) {
+        const AbstractParser *hinted = m_parsers.value(formatHint);
+        if (hinted && hinted->accept(source)) {
+            parser = hinted;
         }
     }
 
-    for (AbstractParser *i : std::as_const(m_parserList)) {
-        if (i->accept(source)) {
-            SpecificDocumentPtr doc = i->parse(source);
-            if (!doc->isValid()) {
-                m_lastError = InvalidFormat;
-                return FeedPtr();
+    if (!parser) {
+        for (const AbstractParser *i : m_parserList) {
+            if (i->accept(source)) {
+                parser = i;
+                break;
             }
+        }
+    }
 
-            return m_mappers[i->format()]->map(doc);
+    if (!parser) {
+        // Documents that are obviously no XML are rejected without building a
+        // DOM. If the root element is known, e.g. of a HTML page, no parser
+        // built a DOM for it, so check the syntax without building one either.
+        const SniffedRoot root = sniffRootElement(source.asByteArray());
+        bool wellFormed = false;
+        if (root.result == SniffedRoot::Found) {
+            wellFormed = isWellFormedXml(source.asByteArray());
+        } else if (root.result == SniffedRoot::Unknown) {
+            wellFormed = !source.asDomDocument().isNull();
         }
+        *error = wellFormed ? XmlNotAccepted : InvalidXml;
+
+        return QSharedPointer<T>();
     }
-    if (source.asDomDocument().isNull()) {
-        m_lastError = InvalidXml;
-    } else {
-        m_lastError = XmlNotAccepted;
+
+    const QString parserFormat = parser->format();
+    accepting.finish(Instrumentation::Accept, parserFormat, source.size());
+    if (format) {
+        *format = parserFormat;
+    }
+
+    const StageTimer parsing;
+    SpecificDocumentPtr doc = parser->parse(source);
+    parsing.finish(Instrumentation::Parse, parserFormat, source.size());
+    if (!doc->isValid()) {
+        *error = InvalidFormat;
+        return QSharedPointer<T>();
     }
 
-    return FeedPtr();
+    const StageTimer mapping;
+    QSharedPointer<T> result = m_mappers.value(parserFormat)->map(doc);
+    if (mapping.isActive()) {
+        const qint64 nsecs = mapping.elapsed();
+        // Feed::items() would map all items, count them in the document instead
+        mapping.report(Instrumentation::Map, parserFormat, source.size(), documentItemCount(doc.data()), nsecs);
+    }
+    return result;
 }
 
 template<class T>
@@ -129,6 +180,18 @@ Syndication::ErrorCode ParserCollectionImpl<T>::lastError() const
     return m_lastError;
 }
 
+template<class T>
+const AbstractParser *ParserCollectionImpl<T>::parser(const QString &format) const
+{
+    return m_parsers.value(format);
+}
+
+template<class T>
+const Mapper<T> *ParserCollectionImpl<T>::mapper(const QString &format) const
+{
+    return m_mappers.value(format);
+}
+
 template<class T>
 ParserCollectionImpl<T>::ParserCollectionImpl(const ParserCollectionImpl &)
 {
@@ -44,12 +44,14 @@ ContentVocab::~ContentVocab() = default;
 
 ContentVocab *ContentVocab::self()
 {
-    static ContentVocabPrivate p;
-    if (!p.sSelf) {
-        p.sSelf = new ContentVocab;
+    // created exactly once, also when first called from several threads
+    static const bool created = [] {
+        ContentVocabPrivate::sSelf = new ContentVocab;
         qAddPostRoutine(ContentVocabPrivate::cleanupContentVocab);
-    }
-    return p.sSelf;
+        return true;
+    }();
+    Q_UNUSED(created)
+    return ContentVocabPrivate::sSelf;
 }
 
 const QString &ContentVocab::namespaceURI() const
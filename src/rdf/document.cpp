@@ -21,6 +21,7 @@
 #include <documentvisitor.h>
 #include <tools.h>
 
+#include <QHash>
 #include <QList>
 #include <QString>
 #include <QStringList>
@@ -47,6 +48,12 @@ public:
     mutable bool itemDescriptionContainsMarkup;
     mutable bool itemDescGuessed;
     QSharedPointer<Model::ModelPrivate> modelPrivate;
+
+    // items() in sequence order, valid as long as the model's revision
+    // does not change
+    mutable QList<Item> items;
+    mutable quint64 itemsRevision = 0;
+    mutable bool itemsCached = false;
 };
 
 Document::Document()
@@ -126,80 +133,74 @@ SyndicationInfo Document::syn() const
 }
 
 struct SortItem {
-    Item item;
-    int index;
+    ResourcePtr resource;
+    int index; // position in the rdf:Seq, -1 if not listed there
 };
 
+// orders by sequence position, and by URI where the position does not
+// decide, to have a defined and deterministic order (important for unit tests)
 struct LessThanByIndex {
     bool operator()(const SortItem &lhs, const SortItem &rhs) const
     {
-        return lhs.index < rhs.index;
-    }
-};
-
-static QList<Item> sortListToMatchSequence(QList<Item> items, const QStringList &uriSequence)
-{
-    QVector<SortItem> toSort;
-    toSort.reserve(items.size());
-    for (const Item &i : items) {
-        SortItem item;
-        item.item = i;
-        item.index = uriSequence.indexOf(i.resource()->uri());
-        toSort.append(item);
-    }
-    std::sort(toSort.begin(), toSort.end(), LessThanByIndex());
-
-    int i = 0;
-    for (const SortItem &sortItem : std::as_const(toSort)) {
-        items[i] = sortItem.item;
-        i++;
-    }
-
-    return items;
-}
-
-struct UriLessThan {
-    bool operator()(const RDF::ResourcePtr &lhs, const RDF::ResourcePtr &rhs) const
-    {
-        return lhs->uri() < rhs->uri();
+        if (lhs.index != rhs.index) {
+            return lhs.index < rhs.index;
+        }
+        return lhs.resource->uri() < rhs.resource->uri();
     }
 };
 
 QList<Item> Document::items() const
 {
-    QList<ResourcePtr> items = resource()->model().resourcesWithType(RSSVocab::self()->item());
-    // if there is no sequence, ensure sorting by URI to have a defined and deterministic order
-    // important for unit tests
-    std::sort(items.begin(), items.end(), UriLessThan());
-
-    DocumentPtr doccpy(new Document(*this));
-
-    QList<Item> list;
-    list.reserve(items.count());
-
-    for (const ResourcePtr &i : std::as_const(items)) {
-        list.append(Item(i, doccpy));
+    const Model model = resource()->model();
+    if (d->itemsCached && model.d && d->itemsRevision == model.d->revision) {
+        return d->items;
     }
 
+    const QList<ResourcePtr> resources = model.resourcesWithType(RSSVocab::self()->item());
+
+    // position of each URI in the rdf:Seq of the channel, if there is one
+    QHash<QString, int> positions;
     if (resource()->hasProperty(RSSVocab::self()->items())) {
         NodePtr n = resource()->property(RSSVocab::self()->items())->object();
         if (n->isSequence()) {
-            const SequencePtr seq = n.staticCast<Sequence>();
-
-            const QList<NodePtr> seqItems = seq->items();
-
-            QStringList uriSequence;
-            uriSequence.reserve(seqItems.size());
+            const QList<NodePtr> seqItems = n.staticCast<Sequence>()->items();
+            positions.reserve(seqItems.size());
 
+            int index = 0;
             for (const NodePtr &i : seqItems) {
                 if (i->isResource()) {
-                    uriSequence.append(i.staticCast<Resource>()->uri());
+                    // the first occurrence counts
+                    const QString uri = i.staticCast<Resource>()->uri();
+                    if (!positions.contains(uri)) {
+                        positions.insert(uri, index);
+                    }
+                    ++index;
                 }
             }
-            list = sortListToMatchSequence(list, uriSequence);
         }
     }
 
+    QVector<SortItem> toSort;
+    toSort.reserve(resources.size());
+    for (const ResourcePtr &i : resources) {
+        toSort.append(SortItem{i, positions.value(i->uri(), -1)});
+    }
+    std::sort(toSort.begin(), toSort.end(), LessThanByIndex());
+
+    DocumentPtr doccpy(new Document(*this));
+
+    QList<Item> list;
+    list.reserve(toSort.size());
+    for (const SortItem &sortItem : std::as_const(toSort)) {
+        list.append(Item(sortItem.resource, doccpy));
+    }
+
+    if (model.d) {
+        d->items = list;
+        d->itemsRevision = model.d->revision;
+        d->itemsCached = true;
+    }
+
     return list;
 }
 
@@ -72,12 +72,14 @@ DublinCoreVocab::~DublinCoreVocab() = default;
 
 DublinCoreVocab *DublinCoreVocab::self()
 {
-    static DublinCoreVocabPrivate p;
-    if (!p.sSelf) {
-        p.sSelf = new DublinCoreVocab;
+    // created exactly once, also when first called from several threads
+    static const bool created = [] {
+        DublinCoreVocabPrivate::sSelf = new DublinCoreVocab;
         qAddPostRoutine(DublinCoreVocabPrivate::cleanupDublinCoreVocab);
-    }
-    return p.sSelf;
+        return true;
+    }();
+    Q_UNUSED(created)
+    return DublinCoreVocabPrivate::sSelf;
 }
 
 const QString &DublinCoreVocab::namespaceURI() const
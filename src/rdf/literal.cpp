@@ -52,7 +52,7 @@ Literal::Literal(const QString &text)
     : d(new LiteralPrivate)
 {
     d->text = text;
-    d->id = idCounter++;
+    d->id = nextId();
 }
 
 Literal::~Literal()
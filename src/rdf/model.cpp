@@ -12,7 +12,7 @@ namespace Syndication
 {
 namespace RDF
 {
-long Model::ModelPrivate::idCounter = 0;
+std::atomic<long> Model::ModelPrivate::idCounter(0);
 
 Model::Model()
     : d(new ModelPrivate)
@@ -110,13 +110,7 @@ void Model::removeStatement(StatementPtr statement)
 
 void Model::removeStatement(ResourcePtr subject, PropertyPtr predicate, NodePtr object)
 {
-    /* clang-format off */
-    QString key = QStringLiteral("%1-%2-%3").arg(QString::number(subject->id()),
-                                                 QString::number(predicate->id()),
-                                                 QString::number(object->id()));
-    /* clang-format on */
-
-    d->removeFromHashes(key);
+    d->removeFromHashes(StatementKey{subject->id(), predicate->id(), object->id()});
 }
 
 StatementPtr Model::addStatement(ResourcePtr subject, PropertyPtr predicate, NodePtr object)
@@ -148,19 +142,13 @@ StatementPtr Model::addStatement(ResourcePtr subject, PropertyPtr predicate, Nod
 
     // TODO: avoid duplicated stmts with literal objects!
 
-    /* clang-format off */
-    QString key = QStringLiteral("%1-%2-%3").arg(QString::number(subjInternal->id()),
-                                                 QString::number(predInternal->id()),
-                                                 QString::number(objInternal->id()));
-    /* clang-format on */
+    const StatementKey key{subjInternal->id(), predInternal->id(), objInternal->id()};
 
-    StatementPtr stmt;
+    StatementPtr stmt = d->statements.value(key);
 
-    if (!d->statements.contains(key)) {
+    if (!stmt) {
         stmt = StatementPtr(new Statement(subjInternal, predInternal, objInternal));
         d->addToHashes(stmt, key);
-    } else {
-        stmt = d->statements[key];
     }
 
     return stmt;
@@ -178,16 +166,7 @@ bool Model::resourceHasProperty(const Resource *resource, PropertyPtr property)
 
 bool Model::ModelPrivate::resourceHasProperty(const Resource *resource, PropertyPtr property) const
 {
-    // resource unknown
-    if (!resources.contains(resource->uri())) {
-        return false;
-    }
-
-    const QList<StatementPtr> &stmts = stmtsBySubject[resource->uri()];
-
-    return std::any_of(stmts.cbegin(), stmts.cend(), [&property](const StatementPtr &p) {
-        return *(p->predicate()) == *property;
-    });
+    return !statementsFor(resource, property.data()).isEmpty();
 }
 
 StatementPtr Model::resourceProperty(const Resource *resource, PropertyPtr property) const
@@ -197,11 +176,8 @@ StatementPtr Model::resourceProperty(const Resource *resource, PropertyPtr prope
 
 StatementPtr Model::ModelPrivate::resourceProperty(const Resource *resource, PropertyPtr property) const
 {
-    const QList<StatementPtr> &stmts = stmtsBySubject[resource->uri()];
-    auto it = std::find_if(stmts.cbegin(), stmts.cend(), [&property](const StatementPtr &p) {
-        return *(p->predicate()) == *property;
-    });
-    return it != stmts.cend() ? *it : nullStatement;
+    const QList<StatementPtr> &stmts = statementsFor(resource, property.data());
+    return !stmts.isEmpty() ? stmts.first() : nullStatement;
 }
 
 QList<StatementPtr> Model::resourceProperties(const Resource *resource, PropertyPtr property) const
@@ -211,16 +187,7 @@ QList<StatementPtr> Model::resourceProperties(const Resource *resource, Property
 
 QList<StatementPtr> Model::ModelPrivate::resourceProperties(const Resource *resource, PropertyPtr property) const
 {
-    QList<StatementPtr> res;
-
-    const QList<StatementPtr> &stmts = stmtsBySubject[resource->uri()];
-    for (const auto &p : stmts) {
-        if (*(p->predicate()) == *property) {
-            res.append(p);
-        }
-    }
-
-    return res;
+    return statementsFor(resource, property.data());
 }
 
 QList<StatementPtr> Model::statements() const
@@ -246,16 +213,8 @@ QString Model::debugInfo() const
 
 QList<ResourcePtr> Model::resourcesWithType(ResourcePtr type) const
 {
-    QList<ResourcePtr> list;
-
-    for (const StatementPtr &stmtPtr : std::as_const(d->statements)) {
-        if (*(stmtPtr->predicate()) == *(RDFVocab::self()->type()) //
-            && stmtPtr->object()->isResource() && *(dynamic_cast<Resource *>(stmtPtr->object().data())) == *type) {
-            list.append(stmtPtr->subject());
-        }
-    }
-
-    return list;
+    const uint typeTerm = d->termOf(type.data());
+    return typeTerm ? d->resourcesByType.value(typeTerm) : QList<ResourcePtr>();
 }
 
 NodePtr Model::nodeByID(uint id) const
@@ -21,21 +21,61 @@
 #include <QList>
 #include <QString>
 
+#include <atomic>
+
 namespace Syndication
 {
 namespace RDF
 {
+/*
+ * identifies a statement by the node IDs of its subject, predicate and
+ * object
+ */
+struct StatementKey {
+    uint subject;
+    uint predicate;
+    uint object;
+
+    bool operator==(const StatementKey &other) const
+    {
+        return subject == other.subject && predicate == other.predicate && object == other.object;
+    }
+};
+
+inline size_t qHash(const StatementKey &key, size_t seed = 0) noexcept
+{
+    return qHashMulti(seed, key.subject, key.predicate, key.object);
+}
+
 class SYNDICATION_NO_EXPORT Model::ModelPrivate
 {
 public:
     long id;
-    static long idCounter;
+    static std::atomic<long> idCounter;
     LiteralPtr nullLiteral;
     PropertyPtr nullProperty;
     ResourcePtr nullResource;
     StatementPtr nullStatement;
-    QHash<QString, StatementPtr> statements;
-    QHash<QString, QList<StatementPtr>> stmtsBySubject;
+    QHash<StatementKey, StatementPtr> statements;
+
+    // Resources are equal if their URIs are, so each URI known to the model
+    // is mapped to a term ID, and the IDs of the resource nodes to the term
+    // of their URI. Term IDs start at 1, 0 means "unknown".
+    QHash<QString, uint> termsByUri;
+    QHash<uint, uint> termsByNodeId;
+
+    // statements by the packed term IDs of subject and predicate, in the
+    // order they were added
+    QHash<quint64, QList<StatementPtr>> stmtsBySubjectAndPredicate;
+
+    // subjects of rdf:type statements by the term ID of the type, in the
+    // order the statements were added
+    QHash<uint, QList<ResourcePtr>> resourcesByType;
+    uint typeTerm = 0; // term ID of rdf:type, 0 until it is used
+
+    // incremented whenever statements are added or removed, so results
+    // computed from the model can be cached
+    quint64 revision = 0;
 
     QHash<int, NodePtr> nodes;
     QHash<QString, ResourcePtr> resources;
@@ -46,7 +86,7 @@ public:
     class AddToHashesVisitor;
 
     ModelPrivate()
-        : id(idCounter++)
+        : id(idCounter.fetch_add(1, std::memory_order_relaxed))
     {
         addToHashesVisitor = new AddToHashesVisitor(this);
         initialized = false;
@@ -74,6 +114,7 @@ public:
         {
             visitNode(res);
             p->resources[res->uri()] = res;
+            p->addTerm(res.data());
             return true;
         }
 
@@ -121,19 +162,85 @@ public:
         addToHashesVisitor->visit(node);
     }
 
-    void addToHashes(StatementPtr stmt, const QString &key)
+    void addTerm(const Resource *resource)
+    {
+        auto it = termsByUri.constFind(resource->uri());
+        if (it == termsByUri.constEnd()) {
+            it = termsByUri.insert(resource->uri(), termsByUri.size() + 1);
+        }
+        termsByNodeId.insert(resource->id(), it.value());
+    }
+
+    // returns the term ID of the resource's URI, or 0 if it is unknown to
+    // the model. Resources of the model are looked up by their ID, others
+    // (e.g. from a vocabulary) by their URI.
+    uint termOf(const Resource *resource) const
+    {
+        const auto it = termsByNodeId.constFind(resource->id());
+        if (it != termsByNodeId.constEnd()) {
+            return it.value();
+        }
+        return termsByUri.value(resource->uri());
+    }
+
+    static quint64 packTerms(uint subject, uint predicate)
+    {
+        return (quint64(subject) << 32) | predicate;
+    }
+
+    const QList<StatementPtr> &statementsFor(const Resource *subject, const Resource *predicate) const
     {
-        statements[key] = stmt;
-        stmtsBySubject[stmt->subject()->uri()].append(stmt);
+        static const QList<StatementPtr> none;
+        const uint subjectTerm = termOf(subject);
+        const uint predicateTerm = subjectTerm ? termOf(predicate) : 0;
+        if (!predicateTerm) {
+            return none;
+        }
+        const auto it = stmtsBySubjectAndPredicate.constFind(packTerms(subjectTerm, predicateTerm));
+        return it != stmtsBySubjectAndPredicate.constEnd() ? it.value() : none;
+    }
+
+    void addToHashes(StatementPtr stmt, const StatementKey &key)
+    {
+        statements.insert(key, stmt);
+        ++revision;
+        const uint predicateTerm = termsByNodeId.value(key.predicate);
+        stmtsBySubjectAndPredicate[packTerms(termsByNodeId.value(key.subject), predicateTerm)].append(stmt);
+
+        if (!typeTerm) {
+            typeTerm = termsByUri.value(RDFVocab::self()->type()->uri());
+        }
+        if (predicateTerm == typeTerm) {
+            const uint objectTerm = termsByNodeId.value(key.object);
+            if (objectTerm) {
+                resourcesByType[objectTerm].append(stmt->subject());
+            }
+        }
     }
 
-    void removeFromHashes(const QString &key)
+    void removeFromHashes(const StatementKey &key)
     {
-        StatementPtr stmt = statements[key];
+        const StatementPtr stmt = statements.take(key);
         if (stmt) {
-            stmtsBySubject[stmt->subject()->uri()].removeAll(stmt);
+            ++revision;
+            const quint64 terms = packTerms(termsByNodeId.value(key.subject), termsByNodeId.value(key.predicate));
+            auto it = stmtsBySubjectAndPredicate.find(terms);
+            if (it != stmtsBySubjectAndPredicate.end()) {
+                it.value().removeAll(stmt);
+                if (it.value().isEmpty()) {
+                    stmtsBySubjectAndPredicate.erase(it);
+                }
+            }
+
+            const uint objectTerm = termsByNodeId.value(key.object);
+            if (typeTerm && termsByNodeId.value(key.predicate) == typeTerm && objectTerm) {
+                auto typeIt = resourcesByType.find(objectTerm);
+                if (typeIt != resourcesByType.end()) {
+                    // the subject is listed once per rdf:type statement
+                    typeIt.value().removeOne(stmt->subject());
+                }
+            }
         }
-        statements.remove(key);
     }
 
     void init(const QSharedPointer<ModelPrivate> &sharedThis)
@@ -8,12 +8,24 @@
 #include "node.h"
 #include "nodevisitor.h"
 
+#include <atomic>
+
 namespace Syndication
 {
 namespace RDF
 {
 unsigned int Node::idCounter = 1;
 
+namespace
+{
+std::atomic<unsigned int> nodeIdCounter(1);
+}
+
+unsigned int Node::nextId()
+{
+    return nodeIdCounter.fetch_add(1, std::memory_order_relaxed);
+}
+
 void Node::accept(NodeVisitor *visitor, NodePtr ptr)
 {
     visitor->visitNode(ptr);
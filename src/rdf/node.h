@@ -108,7 +108,14 @@ public:
 
 protected:
     /*!
-     * used to generate unique IDs for node objects
+     * Returns a new unique ID for a node object.
+     *
+     * This function is thread-safe.
+     */
+    static unsigned int nextId();
+
+    /*!
+     * no longer used, kept for binary compatibility. Use nextId() instead.
      */
     static unsigned int idCounter;
 };
@@ -7,6 +7,7 @@
 
 #include "parser.h"
 #include "document.h"
+#include "documentsniffer_p.h"
 #include "model.h"
 #include "modelmaker.h"
 #include "property.h"
@@ -42,6 +43,14 @@ public:
 
 bool Parser::accept(const DocumentSource &source) const
 {
+    // reject other documents before building a DOM
+    const QByteArray data = source.asByteArray();
+    const SniffedRoot sniffed = sniffRootElement(data);
+    if (sniffed.result == SniffedRoot::NotXml
+        || (sniffed.result == SniffedRoot::Found && QLatin1String(sniffed.namespaceURI) != RDFVocab::self()->namespaceURI())) {
+        return false;
+    }
+
     QDomDocument doc = source.asDomDocument();
 
     if (doc.isNull()) {
@@ -42,7 +42,9 @@ void Property::accept(NodeVisitor *visitor, NodePtr ptr)
 
 Property *Property::clone() const
 {
-    return new Property(*this);
+    Property *prop = new Property(*this);
+    prop->detach();
+    return prop;
 }
 
 } // namespace RDF
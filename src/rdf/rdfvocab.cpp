@@ -35,12 +35,14 @@ RDFVocab *RDFVocab::RDFVocabPrivate::sSelf = nullptr;
 
 RDFVocab *RDFVocab::self()
 {
-    static RDFVocabPrivate p;
-    if (!p.sSelf) {
-        p.sSelf = new RDFVocab;
+    // created exactly once, also when first called from several threads
+    static const bool created = [] {
+        RDFVocabPrivate::sSelf = new RDFVocab;
         qAddPostRoutine(RDFVocabPrivate::cleanupRDFVocab);
-    }
-    return p.sSelf;
+        return true;
+    }();
+    Q_UNUSED(created)
+    return RDFVocabPrivate::sSelf;
 }
 
 RDFVocab::RDFVocab()
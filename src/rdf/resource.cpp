@@ -61,7 +61,7 @@ Resource::Resource(const QString &uri)
         d->isAnon = false;
     }
 
-    d->id = idCounter++;
+    d->id = nextId();
 }
 
 Resource::~Resource()
@@ -122,7 +122,9 @@ QList<StatementPtr> Resource::properties(PropertyPtr property) const
 
 Resource *Resource::clone() const
 {
-    return new Resource(*this);
+    Resource *res = new Resource(*this);
+    res->detach();
+    return res;
 }
 
 void Resource::accept(NodeVisitor *visitor, NodePtr ptr)
@@ -199,6 +201,13 @@ void Resource::setId(unsigned int id)
     }
 }
 
+void Resource::detach()
+{
+    if (d) {
+        d = ResourcePrivatePtr(new ResourcePrivate(*d));
+    }
+}
+
 QString Resource::text() const
 {
     return QString();
@@ -185,6 +185,15 @@ public:
      */
     void setId(unsigned int id) override;
 
+protected:
+    /*!
+     * gives this object its own copy of the resource data, so that
+     * setModel() and setId() do not affect the object it was copied from.
+     * Used by clone(), as copies otherwise share their data.
+     * @internal
+     */
+    void detach();
+
 private:
     class ResourcePrivate;
     typedef QSharedPointer<ResourcePrivate> ResourcePrivatePtr;
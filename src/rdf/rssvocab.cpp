@@ -62,12 +62,14 @@ RSSVocab::~RSSVocab() = default;
 
 RSSVocab *RSSVocab::self()
 {
-    static RSSVocabPrivate p;
-    if (!p.sSelf) {
-        p.sSelf = new RSSVocab;
+    // created exactly once, also when first called from several threads
+    static const bool created = [] {
+        RSSVocabPrivate::sSelf = new RSSVocab;
         qAddPostRoutine(RSSVocabPrivate::cleanupRSSVocab);
-    }
-    return p.sSelf;
+        return true;
+    }();
+    Q_UNUSED(created)
+    return RSSVocabPrivate::sSelf;
 }
 
 const QString &RSSVocab::namespaceURI() const
@@ -181,10 +183,13 @@ RSS09Vocab::~RSS09Vocab() = default;
 
 RSS09Vocab *RSS09Vocab::self()
 {
-    if (!RSS09VocabPrivate::sSelf) {
+    // created exactly once, also when first called from several threads
+    static const bool created = [] {
         RSS09VocabPrivate::sSelf = new RSS09Vocab;
         qAddPostRoutine(RSS09VocabPrivate::cleanupRSS09Vocab);
-    }
+        return true;
+    }();
+    Q_UNUSED(created)
     return RSS09VocabPrivate::sSelf;
 }
 
@@ -53,7 +53,9 @@ void Sequence::accept(NodeVisitor *visitor, NodePtr ptr)
 
 Sequence *Sequence::clone() const
 {
-    return new Sequence(*this);
+    Sequence *seq = new Sequence(*this);
+    seq->detach();
+    return seq;
 }
 
 Sequence &Sequence::operator=(const Sequence &other)
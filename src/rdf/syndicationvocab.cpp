@@ -48,12 +48,14 @@ SyndicationVocab::~SyndicationVocab() = default;
 
 SyndicationVocab *SyndicationVocab::self()
 {
-    static SyndicationVocabPrivate p;
-    if (!p.sSelf) {
-        p.sSelf = new SyndicationVocab;
+    // created exactly once, also when first called from several threads
+    static const bool created = [] {
+        SyndicationVocabPrivate::sSelf = new SyndicationVocab;
         qAddPostRoutine(SyndicationVocabPrivate::cleanupSyndicationVocab);
-    }
-    return p.sSelf;
+        return true;
+    }();
+    Q_UNUSED(created)
+    return SyndicationVocabPrivate::sSelf;
 }
 
 const QString &SyndicationVocab::namespaceURI() const
@@ -8,6 +8,7 @@
 #include <rss2/category.h>
 #include <rss2/cloud.h>
 #include <rss2/document.h>
+#include <rss2/elementnames_p.h>
 #include <rss2/image.h>
 #include <rss2/item.h>
 #include <rss2/textinput.h>
@@ -283,44 +284,15 @@ QList<Item> Document::items() const
 
     return items;
 }
+
 QList<QDomElement> Document::unhandledElements() const
 {
-    // TODO: do not hardcode this list here
-    static std::vector<ElementType> handled; // QVector would require a default ctor, and ElementType is too big for QList
-    if (handled.empty()) {
-        handled.reserve(22);
-        handled.push_back(ElementType(QStringLiteral("title")));
-        handled.push_back(ElementType(QStringLiteral("link")));
-        handled.push_back(ElementType(QStringLiteral("description")));
-        handled.push_back(ElementType(QStringLiteral("language")));
-        handled.push_back(ElementType(QStringLiteral("copyright")));
-        handled.push_back(ElementType(QStringLiteral("managingEditor")));
-        handled.push_back(ElementType(QStringLiteral("webMaster")));
-        handled.push_back(ElementType(QStringLiteral("pubDate")));
-        handled.push_back(ElementType(QStringLiteral("lastBuildDate")));
-        handled.push_back(ElementType(QStringLiteral("skipDays")));
-        handled.push_back(ElementType(QStringLiteral("skipHours")));
-        handled.push_back(ElementType(QStringLiteral("item")));
-        handled.push_back(ElementType(QStringLiteral("textinput")));
-        handled.push_back(ElementType(QStringLiteral("textInput")));
-        handled.push_back(ElementType(QStringLiteral("image")));
-        handled.push_back(ElementType(QStringLiteral("ttl")));
-        handled.push_back(ElementType(QStringLiteral("generator")));
-        handled.push_back(ElementType(QStringLiteral("docs")));
-        handled.push_back(ElementType(QStringLiteral("cloud")));
-        handled.push_back(ElementType(QStringLiteral("language"), dublinCoreNamespace()));
-        handled.push_back(ElementType(QStringLiteral("rights"), dublinCoreNamespace()));
-        handled.push_back(ElementType(QStringLiteral("date"), dublinCoreNamespace()));
-    }
-
     QList<QDomElement> notHandled;
 
-    QDomNodeList children = element().childNodes();
-    const int numChildren = children.size();
-    for (int i = 0; i < numChildren; ++i) {
-        QDomElement el = children.at(i).toElement();
+    for (QDomNode n = element().firstChild(); !n.isNull(); n = n.nextSibling()) {
+        const QDomElement el = n.toElement();
         if (!el.isNull() //
-            && std::find(handled.cbegin(), handled.cend(), ElementType(el.localName(), el.namespaceURI())) == handled.cend()) {
+            && !handledChannelElements.contains(el.namespaceURI(), el.localName())) {
             notHandled.append(el);
         }
     }
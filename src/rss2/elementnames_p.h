@@ -0,0 +1,75 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_RSS2_ELEMENTNAMES_P_H
+#define SYNDICATION_RSS2_ELEMENTNAMES_P_H
+
+#include <elementnameset_p.h>
+
+namespace Syndication
+{
+namespace RSS2
+{
+//@cond PRIVATE
+inline constexpr QLatin1String dcElementNamespace("http://purl.org/dc/elements/1.1/"); // dublinCoreNamespace()
+
+/*!
+ * \internal
+ * the child elements of \c &lt;channel> covered by the accessors of
+ * Document, shared with the streaming parser
+ */
+inline constexpr ElementName channelElements[] = {
+    {QLatin1String(""), QLatin1String("title")},
+    {QLatin1String(""), QLatin1String("link")},
+    {QLatin1String(""), QLatin1String("description")},
+    {QLatin1String(""), QLatin1String("language")},
+    {QLatin1String(""), QLatin1String("copyright")},
+    {QLatin1String(""), QLatin1String("managingEditor")},
+    {QLatin1String(""), QLatin1String("webMaster")},
+    {QLatin1String(""), QLatin1String("pubDate")},
+    {QLatin1String(""), QLatin1String("lastBuildDate")},
+    {QLatin1String(""), QLatin1String("skipDays")},
+    {QLatin1String(""), QLatin1String("skipHours")},
+    {QLatin1String(""), QLatin1String("item")},
+    {QLatin1String(""), QLatin1String("textinput")},
+    {QLatin1String(""), QLatin1String("textInput")},
+    {QLatin1String(""), QLatin1String("image")},
+    {QLatin1String(""), QLatin1String("ttl")},
+    {QLatin1String(""), QLatin1String("generator")},
+    {QLatin1String(""), QLatin1String("docs")},
+    {QLatin1String(""), QLatin1String("cloud")},
+    {dcElementNamespace, QLatin1String("language")},
+    {dcElementNamespace, QLatin1String("rights")},
+    {dcElementNamespace, QLatin1String("date")},
+};
+inline constexpr auto handledChannelElements = makeElementNameSet<64, 13>(channelElements);
+
+/*!
+ * \internal
+ * the child elements of \c &lt;item> covered by the accessors of Item,
+ * shared with the streaming parser
+ */
+inline constexpr ElementName itemElements[] = {
+    {QLatin1String(""), QLatin1String("title")},
+    {QLatin1String(""), QLatin1String("link")},
+    {QLatin1String(""), QLatin1String("description")},
+    {QLatin1String(""), QLatin1String("pubDate")},
+    {QLatin1String(""), QLatin1String("expirationDate")},
+    {QLatin1String(""), QLatin1String("rating")},
+    {QLatin1String(""), QLatin1String("source")},
+    {QLatin1String(""), QLatin1String("guid")},
+    {QLatin1String(""), QLatin1String("comments")},
+    {QLatin1String(""), QLatin1String("author")},
+    {dcElementNamespace, QLatin1String("date")},
+};
+inline constexpr auto handledItemElements = makeElementNameSet<32, 1>(itemElements);
+//@endcond
+
+} // namespace RSS2
+} // namespace Syndication
+
+#endif // SYNDICATION_RSS2_ELEMENTNAMES_P_H
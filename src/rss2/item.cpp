@@ -7,6 +7,7 @@
 
 #include <constants.h>
 #include <rss2/category.h>
+#include <rss2/elementnames_p.h>
 #include <rss2/enclosure.h>
 #include <rss2/item.h>
 #include <rss2/source.h>
@@ -19,7 +20,7 @@
 #include <QList>
 #include <QString>
 
-#include <vector>
+#include <memory>
 
 namespace Syndication
 {
@@ -29,6 +30,34 @@ class SYNDICATION_NO_EXPORT Item::ItemPrivate
 {
 public:
     QSharedPointer<Document> doc;
+
+    // the known child elements, read in one pass by materialize().
+    // Text fields follow extractElementTextNS(): null if there is no such
+    // element, the trimmed text of the first one otherwise.
+    struct Fields {
+        QString title;
+        QString link;
+        QString description;
+        QString comments;
+        QString author;
+        QString dcCreator;
+        QString guid;
+        bool guidIsPermaLink = true;
+        QString pubDate;
+        QString dcDate;
+        QString expirationDate;
+        QString rating;
+        QDomElement source;
+        QList<QDomElement> categories;
+        QList<QDomElement> enclosures;
+        // content, computed from the elements below on first use
+        QDomElement contentEncoded;
+        QDomElement xhtmlBody;
+        QDomElement xhtmlDiv;
+        QString content;
+        bool contentExtracted = false;
+    };
+    std::unique_ptr<Fields> fields;
 };
 
 Item::Item(QSharedPointer<Document> doc)
@@ -64,6 +93,107 @@ Item &Item::operator=(const Item &other)
     return *this;
 }
 
+void Item::materialize() const
+{
+    if (d->fields) {
+        return;
+    }
+
+    auto fields = std::make_unique<ItemPrivate::Fields>();
+    if (isNull()) {
+        fields->contentExtracted = true;
+        d->fields = std::move(fields);
+        return;
+    }
+
+    // keep the text of the first child element with the given name
+    auto setText = [](QString &field, bool &seen, const QDomElement &e) {
+        if (!seen) {
+            field = e.text().trimmed();
+            seen = true;
+        }
+    };
+    auto setElement = [](QDomElement &field, const QDomElement &e) {
+        if (field.isNull()) {
+            field = e;
+        }
+    };
+
+    bool title = false;
+    bool link = false;
+    bool description = false;
+    bool comments = false;
+    bool author = false;
+    bool dcCreator = false;
+    bool guid = false;
+    bool pubDate = false;
+    bool dcDate = false;
+    bool expirationDate = false;
+    bool rating = false;
+
+    const QString dcNamespace = dublinCoreNamespace();
+    const QString contentNamespace = contentNameSpace();
+    const QString xhtmlNs = xhtmlNamespace();
+
+    for (QDomNode n = element().firstChild(); !n.isNull(); n = n.nextSibling()) {
+        if (!n.isElement()) {
+            continue;
+        }
+        const QDomElement e = n.toElement();
+        const QString ns = e.namespaceURI();
+        const QString name = e.localName();
+
+        if (ns.isEmpty()) {
+            if (name == QLatin1String("title")) {
+                setText(fields->title, title, e);
+            } else if (name == QLatin1String("link")) {
+                setText(fields->link, link, e);
+            } else if (name == QLatin1String("description")) {
+                setText(fields->description, description, e);
+            } else if (name == QLatin1String("comments")) {
+                setText(fields->comments, comments, e);
+            } else if (name == QLatin1String("author")) {
+                setText(fields->author, author, e);
+            } else if (name == QLatin1String("guid")) {
+                if (!guid) {
+                    fields->guidIsPermaLink = e.attribute(QStringLiteral("isPermaLink")) != QLatin1String("false");
+                }
+                setText(fields->guid, guid, e);
+            } else if (name == QLatin1String("pubDate")) {
+                setText(fields->pubDate, pubDate, e);
+            } else if (name == QLatin1String("expirationDate")) {
+                setText(fields->expirationDate, expirationDate, e);
+            } else if (name == QLatin1String("rating")) {
+                setText(fields->rating, rating, e);
+            } else if (name == QLatin1String("source")) {
+                setElement(fields->source, e);
+            } else if (name == QLatin1String("category")) {
+                fields->categories.append(e);
+            } else if (name == QLatin1String("enclosure")) {
+                fields->enclosures.append(e);
+            }
+        } else if (ns == dcNamespace) {
+            if (name == QLatin1String("creator")) {
+                setText(fields->dcCreator, dcCreator, e);
+            } else if (name == QLatin1String("date")) {
+                setText(fields->dcDate, dcDate, e);
+            }
+        } else if (ns == contentNamespace) {
+            if (name == QLatin1String("encoded")) {
+                setElement(fields->contentEncoded, e);
+            }
+        } else if (ns == xhtmlNs) {
+            if (name == QLatin1String("body")) {
+                setElement(fields->xhtmlBody, e);
+            } else if (name == QLatin1String("div")) {
+                setElement(fields->xhtmlDiv, e);
+            }
+        }
+    }
+
+    d->fields = std::move(fields);
+}
+
 QString Item::title() const
 {
     if (!d->doc) {
@@ -79,17 +209,23 @@ QString Item::title() const
 
 QString Item::originalDescription() const
 {
+    if (d->fields) {
+        return d->fields->description;
+    }
     return extractElementTextNS(QString(), QStringLiteral("description"));
 }
 
 QString Item::originalTitle() const
 {
+    if (d->fields) {
+        return d->fields->title;
+    }
     return extractElementTextNS(QString(), QStringLiteral("title"));
 }
 
 QString Item::link() const
 {
-    QString url = extractElementTextNS(QString(), QStringLiteral("link"));
+    QString url = d->fields ? d->fields->link : extractElementTextNS(QString(), QStringLiteral("link"));
     if (url.startsWith(QLatin1String("http://")) || url.startsWith(QLatin1String("https://"))) {
         return url;
     }
@@ -124,13 +260,29 @@ QString Item::description() const
 
 QString Item::content() const
 {
+    if (d->fields) {
+        ItemPrivate::Fields &fields = *d->fields;
+        if (!fields.contentExtracted) {
+            // same order of preference as extractContent()
+            if (!fields.contentEncoded.isNull()) {
+                fields.content = fields.contentEncoded.text().trimmed();
+            } else if (!fields.xhtmlBody.isNull()) {
+                fields.content = ElementWrapper::childNodesAsXML(fields.xhtmlBody).trimmed();
+            } else if (!fields.xhtmlDiv.isNull()) {
+                fields.content = ElementWrapper::childNodesAsXML(fields.xhtmlDiv).trimmed();
+            }
+            fields.contentExtracted = true;
+        }
+        return fields.content;
+    }
+
     // parse encoded stuff from content:encoded, xhtml:body and friends into content
     return extractContent(*this);
 }
 
 QList<Category> Item::categories() const
 {
-    const QList<QDomElement> cats = elementsByTagNameNS(QString(), QStringLiteral("category"));
+    const QList<QDomElement> cats = d->fields ? d->fields->categories : elementsByTagNameNS(QString(), QStringLiteral("category"));
 
     QList<Category> categories;
     categories.reserve(cats.count());
@@ -144,11 +296,17 @@ QList<Category> Item::categories() const
 
 QString Item::comments() const
 {
+    if (d->fields) {
+        return d->fields->comments;
+    }
     return extractElementTextNS(QString(), QStringLiteral("comments"));
 }
 
 QString Item::author() const
 {
+    if (d->fields) {
+        return !d->fields->author.isNull() ? d->fields->author : d->fields->dcCreator;
+    }
     QString a = extractElementTextNS(QString(), QStringLiteral("author"));
     if (!a.isNull()) {
         return a;
@@ -160,7 +318,7 @@ QString Item::author() const
 
 QList<Enclosure> Item::enclosures() const
 {
-    const QList<QDomElement> encs = elementsByTagNameNS(QString(), QStringLiteral("enclosure"));
+    const QList<QDomElement> encs = d->fields ? d->fields->enclosures : elementsByTagNameNS(QString(), QStringLiteral("enclosure"));
 
     QList<Enclosure> enclosures;
     enclosures.reserve(encs.count());
@@ -174,11 +332,18 @@ QList<Enclosure> Item::enclosures() const
 
 QString Item::guid() const
 {
+    if (d->fields) {
+        return d->fields->guid;
+    }
     return extractElementTextNS(QString(), QStringLiteral("guid"));
 }
 
 bool Item::guidIsPermaLink() const
 {
+    if (d->fields) {
+        return d->fields->guidIsPermaLink;
+    }
+
     bool guidIsPermaLink = true; // true is default
 
     QDomElement guidNode = firstElementByTagNameNS(QString(), QStringLiteral("guid"));
@@ -193,6 +358,13 @@ bool Item::guidIsPermaLink() const
 
 time_t Item::pubDate() const
 {
+    if (d->fields) {
+        if (!d->fields->pubDate.isNull()) {
+            return parseDate(d->fields->pubDate, RFCDate);
+        }
+        return parseDate(d->fields->dcDate, ISODate);
+    }
+
     QString str = extractElementTextNS(QString(), QStringLiteral("pubDate"));
 
     if (!str.isNull()) {
@@ -206,17 +378,26 @@ time_t Item::pubDate() const
 
 time_t Item::expirationDate() const
 {
+    if (d->fields) {
+        return parseDate(d->fields->expirationDate, RFCDate);
+    }
     QString str = extractElementTextNS(QString(), QStringLiteral("expirationDate"));
     return parseDate(str, RFCDate);
 }
 
 Source Item::source() const
 {
+    if (d->fields) {
+        return Source(d->fields->source);
+    }
     return Source(firstElementByTagNameNS(QString(), QStringLiteral("source")));
 }
 
 QString Item::rating() const
 {
+    if (d->fields) {
+        return d->fields->rating;
+    }
     return extractElementTextNS(QString(), QStringLiteral("rating"));
 }
 
@@ -271,31 +452,12 @@ QString Item::debugInfo() const
 
 QList<QDomElement> Item::unhandledElements() const
 {
-    // TODO: do not hardcode this list here
-    static std::vector<ElementType> handled; // QVector would require a default ctor, and ElementType is too big for QList
-    if (handled.empty()) {
-        handled.reserve(11);
-        handled.push_back(ElementType(QStringLiteral("title")));
-        handled.push_back(ElementType(QStringLiteral("link")));
-        handled.push_back(ElementType(QStringLiteral("description")));
-        handled.push_back(ElementType(QStringLiteral("pubDate")));
-        handled.push_back(ElementType(QStringLiteral("expirationDate")));
-        handled.push_back(ElementType(QStringLiteral("rating")));
-        handled.push_back(ElementType(QStringLiteral("source")));
-        handled.push_back(ElementType(QStringLiteral("guid")));
-        handled.push_back(ElementType(QStringLiteral("comments")));
-        handled.push_back(ElementType(QStringLiteral("author")));
-        handled.push_back(ElementType(QStringLiteral("date"), dublinCoreNamespace()));
-    }
-
     QList<QDomElement> notHandled;
 
-    QDomNodeList children = element().childNodes();
-    const int numChildren = children.size();
-    for (int i = 0; i < numChildren; ++i) {
-        QDomElement el = children.at(i).toElement();
+    for (QDomNode n = element().firstChild(); !n.isNull(); n = n.nextSibling()) {
+        const QDomElement el = n.toElement();
         if (!el.isNull() //
-            && std::find(handled.cbegin(), handled.cend(), ElementType(el.localName(), el.namespaceURI())) == handled.cend()) {
+            && !handledItemElements.contains(el.namespaceURI(), el.localName())) {
             notHandled.append(el);
         }
     }
@@ -79,6 +79,18 @@ public:
      */
     bool accept(SpecificItemVisitor *visitor) override;
 
+    /*!
+     * Reads all child elements known to this class in a single pass over
+     * the item's children and keeps their content, so that the accessors
+     * no longer search the DOM on every call. This pays off when most
+     * fields of an item are read, e.g. when mapping it to a Syndication::Item.
+     *
+     * The content is shared with all copies of this item. Changes to the
+     * wrapped element made after calling this are not reflected by the
+     * accessors.
+     */
+    void materialize() const;
+
     /*!
      * The title of the item.
      *
@@ -7,6 +7,7 @@
 
 #include "parser.h"
 #include "document.h"
+#include "documentsniffer_p.h"
 
 #include <documentsource.h>
 
@@ -23,6 +24,12 @@ class SYNDICATION_NO_EXPORT Parser::ParserPrivate
 
 bool Parser::accept(const Syndication::DocumentSource &source) const
 {
+    // reject other documents before building a DOM
+    const QByteArray data = source.asByteArray();
+    if (sniffRootElement(data).excludesName("rss")) {
+        return false;
+    }
+
     QDomDocument doc = source.asDomDocument();
     if (doc.isNull()) {
         return false;
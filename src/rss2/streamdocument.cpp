@@ -0,0 +1,119 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include <rss2/streamdocument.h>
+
+#include <tools.h>
+
+#include <QDomDocument>
+#include <QDomElement>
+#include <QString>
+
+namespace Syndication
+{
+namespace RSS2
+{
+QDomElement StreamElement::toElement() const
+{
+    QDomDocument doc;
+    if (!doc.setContent(xml, QDomDocument::ParseOption::UseNamespaceProcessing)) {
+        return QDomElement();
+    }
+    return doc.documentElement();
+}
+
+StreamDocument::StreamDocument()
+    : m_valid(false)
+{
+}
+
+StreamDocument::StreamDocument(const ChannelRecord &channel, const QList<ItemRecord> &items)
+    : m_valid(true)
+    , m_channel(channel)
+    , m_items(items)
+{
+}
+
+StreamDocument::~StreamDocument()
+{
+}
+
+bool StreamDocument::accept(DocumentVisitor *visitor)
+{
+    Q_UNUSED(visitor)
+    return false;
+}
+
+bool StreamDocument::isValid() const
+{
+    return m_valid;
+}
+
+const ChannelRecord &StreamDocument::channel() const
+{
+    return m_channel;
+}
+
+const QList<ItemRecord> &StreamDocument::items() const
+{
+    return m_items;
+}
+
+QString StreamDocument::debugInfo() const
+{
+    QString info;
+    info += QLatin1String("### StreamDocument: ###################\n");
+    if (!m_channel.title.isNull()) {
+        info += QLatin1String("title: #") + m_channel.title + QLatin1String("#\n");
+    }
+    if (!m_channel.link.isNull()) {
+        info += QLatin1String("link: #") + m_channel.link + QLatin1String("#\n");
+    }
+    for (const ItemRecord &item : m_items) {
+        info += QLatin1String("### Item: ###################\n");
+        if (!item.title.isNull()) {
+            info += QLatin1String("title: #") + item.title + QLatin1String("#\n");
+        }
+        if (!item.link.isNull()) {
+            info += QLatin1String("link: #") + item.link + QLatin1String("#\n");
+        }
+        const QString dpubdate = dateTimeToString(item.pubDate);
+        if (!dpubdate.isNull()) {
+            info += QLatin1String("pubDate: #") + dpubdate + QLatin1String("#\n");
+        }
+        if (!item.guid.isNull()) {
+            info += QLatin1String("guid: #") + item.guid + QLatin1String("#\n");
+        }
+        info += QLatin1String("### Item end ################\n");
+    }
+    info += QLatin1String("### StreamDocument end ################\n");
+    return info;
+}
+
+StreamItem::StreamItem(StreamDocumentPtr doc, int index)
+    : m_doc(doc)
+    , m_index(index)
+{
+}
+
+StreamItem::~StreamItem()
+{
+}
+
+bool StreamItem::accept(SpecificItemVisitor *visitor)
+{
+    Q_UNUSED(visitor)
+    return false;
+}
+
+const ItemRecord &StreamItem::record() const
+{
+    return m_doc->items().at(m_index);
+}
+
+} // namespace RSS2
+} // namespace Syndication
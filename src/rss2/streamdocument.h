@@ -0,0 +1,206 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_RSS2_STREAMDOCUMENT_H
+#define SYNDICATION_RSS2_STREAMDOCUMENT_H
+
+#include <syndication/specificdocument.h>
+#include <syndication/specificitem.h>
+
+#include <QList>
+#include <QString>
+
+#include <ctime>
+
+class QDomElement;
+
+namespace Syndication
+{
+namespace RSS2
+{
+class StreamDocument;
+typedef QSharedPointer<StreamDocument> StreamDocumentPtr;
+
+//@cond PRIVATE
+/*!
+ * \internal
+ * A child element not covered by the record fields, kept as serialized
+ * XML so it can be turned into a DOM element on demand.
+ */
+struct StreamElement {
+    QString key; // namespace URI + local name, as used by additionalProperties()
+    QString xml;
+
+    QDomElement toElement() const;
+};
+
+/*!
+ * \internal
+ * the content of a \c &lt;category> element
+ */
+struct StreamCategory {
+    QString category;
+    QString domain;
+};
+
+/*!
+ * \internal
+ * the attributes of an \c &lt;enclosure> element
+ */
+struct StreamEnclosure {
+    QString url;
+    QString type;
+    int length = 0;
+};
+
+/*!
+ * \internal
+ * the content of the channel's \c &lt;image> element
+ */
+struct StreamImage {
+    bool isNull = true;
+    QString url;
+    QString title;
+    QString link;
+    QString description;
+    uint width = 88;
+    uint height = 31;
+};
+
+/*!
+ * \internal
+ * All fields of an \c &lt;item> the mapper needs, extracted in one pass.
+ * Fallbacks (dc:creator for author, dc:date for pubDate, ...) are already
+ * resolved, title and description are normalized using the feed-wide
+ * format guess, and relative links are completed with the channel link.
+ */
+struct ItemRecord {
+    QString title;
+    QString link;
+    QString description;
+    QString content;
+    QString comments;
+    QString author;
+    QString guid;
+    bool guidIsPermaLink = true;
+    time_t pubDate = 0;
+    time_t updated = 0;
+    QString slashComments;
+    QString commentRss;
+    QString commentPostUri;
+    QString duration;
+    QList<StreamCategory> categories;
+    QList<StreamEnclosure> enclosures;
+    QList<StreamElement> unhandled;
+    quint64 fingerprint = 0; // content digest of ItemFingerprint, taken while reading
+    quint64 identity = 0; // identity digest of ItemFingerprint, of the fields as read
+};
+
+/*!
+ * \internal
+ * All fields of the \c &lt;channel> the mapper needs.
+ */
+struct ChannelRecord {
+    QString title;
+    QString link;
+    QString description;
+    QString language;
+    QString copyright;
+    QList<StreamCategory> categories;
+    StreamImage image;
+    QList<StreamElement> unhandled;
+};
+//@endcond
+
+/*!
+ * Document implementation for the streaming RSS 0.9x/2.0 parser.
+ *
+ * Unlike Document, this does not wrap a DOM tree: the channel and its
+ * items are read in a single forward pass over the source and kept as
+ * compact records, so no QDomDocument is built or retained.
+ */
+class StreamDocument : public Syndication::SpecificDocument
+{
+public:
+    /*!
+     * creates an invalid document
+     */
+    StreamDocument();
+
+    /*!
+     * creates a valid document from the records read by the parser
+     *
+     * \a channel the channel record
+     * \a items the item records, in document order
+     */
+    StreamDocument(const ChannelRecord &channel, const QList<ItemRecord> &items);
+
+    ~StreamDocument() override;
+
+    /*!
+     * There is no visitor method for streamed documents, so this
+     * always returns @c false.
+     */
+    bool accept(DocumentVisitor *visitor) override;
+
+    /*!
+     * returns whether a channel was read successfully
+     */
+    bool isValid() const override;
+
+    /*!
+     * the channel record
+     */
+    const ChannelRecord &channel() const;
+
+    /*!
+     * the item records, in document order
+     */
+    const QList<ItemRecord> &items() const;
+
+    QString debugInfo() const override;
+
+private:
+    bool m_valid;
+    ChannelRecord m_channel;
+    QList<ItemRecord> m_items;
+};
+
+/*!
+ * Item interface for an item record of a StreamDocument.
+ */
+class StreamItem : public Syndication::SpecificItem
+{
+public:
+    /*!
+     * \a doc the document the item belongs to
+     * \a index position of the item in StreamDocument::items()
+     */
+    StreamItem(StreamDocumentPtr doc, int index);
+
+    ~StreamItem() override;
+
+    /*!
+     * There is no visitor method for streamed items, so this
+     * always returns @c false.
+     */
+    bool accept(SpecificItemVisitor *visitor) override;
+
+    /*!
+     * the record of this item
+     */
+    const ItemRecord &record() const;
+
+private:
+    StreamDocumentPtr m_doc;
+    int m_index;
+};
+
+} // namespace RSS2
+} // namespace Syndication
+
+#endif // SYNDICATION_RSS2_STREAMDOCUMENT_H
@@ -0,0 +1,42 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "streamparser.h"
+#include "streamdocument.h"
+#include "streamreader_p.h"
+
+#include <documentsource.h>
+
+#include <QString>
+
+namespace Syndication
+{
+namespace RSS2
+{
+StreamParser::StreamParser() = default;
+
+StreamParser::~StreamParser() = default;
+
+bool StreamParser::accept(const Syndication::DocumentSource &source) const
+{
+    return StreamReader::isRssDocument(source.asByteArray());
+}
+
+Syndication::SpecificDocumentPtr StreamParser::parse(const DocumentSource &source) const
+{
+    StreamReader reader;
+    reader.addData(source.asByteArray());
+    return reader.finish();
+}
+
+QString StreamParser::format() const
+{
+    return QStringLiteral("rss2stream");
+}
+
+} // namespace RSS2
+} // namespace Syndication
@@ -0,0 +1,64 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_RSS2_STREAMPARSER_H
+#define SYNDICATION_RSS2_STREAMPARSER_H
+
+#include <syndication/abstractparser.h>
+
+namespace Syndication
+{
+class DocumentSource;
+
+namespace RSS2
+{
+/*!
+ * Streaming parser implementation for the RSS 0.9x/2.0 format family.
+ *
+ * Reads the source in a single pass with QXmlStreamReader and produces a
+ * StreamDocument, without building a QDomDocument. Registered in the
+ * global parser collection with the format string "rss2stream"; pass it
+ * as format hint to Syndication::parse() to use it.
+ */
+class StreamParser : public Syndication::AbstractParser
+{
+public:
+    StreamParser();
+    ~StreamParser() override;
+
+    /*!
+     * checks whether the root element of the source is @c &lt;rss>.
+     * Only the prolog and the root start tag are read.
+     *
+     * \a source a document source to check
+     * @return @c true if the source looks like an RSS2 document
+     */
+    bool accept(const DocumentSource &source) const override;
+
+    /*!
+     * reads the document source in a single pass.
+     *
+     * \a source the source to read
+     * @return a StreamDocument, which is invalid if the source is not
+     * well-formed or has no @c &lt;channel> element
+     */
+    Syndication::SpecificDocumentPtr parse(const DocumentSource &source) const override;
+
+    /*!
+     * @return @c "rss2stream"
+     */
+    QString format() const override;
+
+private:
+    StreamParser(const StreamParser &other);
+    StreamParser &operator=(const StreamParser &other);
+};
+
+} // namespace RSS2
+} // namespace Syndication
+
+#endif // SYNDICATION_RSS2_STREAMPARSER_H
@@ -0,0 +1,681 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "streamreader_p.h"
+#include "elementnames_p.h"
+
+#include <atom/constants.h>
+#include <constants.h>
+#include <tools.h>
+
+#include <QByteArray>
+#include <QStringList>
+#include <QXmlStreamAttributes>
+#include <QXmlStreamWriter>
+
+namespace Syndication
+{
+namespace RSS2
+{
+//@cond PRIVATE
+namespace
+{
+quint64 fieldBit(int field)
+{
+    return quint64(1) << field;
+}
+
+QString attributeValue(const QXmlStreamAttributes &attributes, QLatin1String name)
+{
+    return attributes.hasAttribute(name) ? attributes.value(name).toString() : QString();
+}
+
+} // namespace
+
+StreamReader::StreamReader()
+    : m_dcNs(dublinCoreNamespace())
+    , m_contentNs(contentNameSpace())
+    , m_xhtmlNs(xhtmlNamespace())
+    , m_slashNs(slashNamespace())
+    , m_commentApiNs(commentApiNamespace())
+    , m_itunesNs(itunesNamespace())
+    , m_atomNs(Atom::atom1Namespace())
+{
+    m_reader.setNamespaceProcessing(true);
+}
+
+StreamReader::~StreamReader()
+{
+}
+
+void StreamReader::addData(const QByteArray &data)
+{
+    if (m_failed || m_complete) {
+        return;
+    }
+    m_reader.addData(data);
+    process();
+}
+
+bool StreamReader::hasError() const
+{
+    return m_failed;
+}
+
+bool StreamReader::isComplete() const
+{
+    return m_complete;
+}
+
+StreamDocumentPtr StreamReader::finish()
+{
+    if (m_failed || !m_complete || !m_channelSeen) {
+        return StreamDocumentPtr(new StreamDocument());
+    }
+    finishDocument();
+    return StreamDocumentPtr(new StreamDocument(m_channel, m_items));
+}
+
+bool StreamReader::isRssDocument(const QByteArray &data)
+{
+    QXmlStreamReader reader(data);
+    while (!reader.atEnd()) {
+        if (reader.readNext() == QXmlStreamReader::StartElement) {
+            return reader.qualifiedName() == QLatin1String("rss");
+        }
+    }
+    return false;
+}
+
+void StreamReader::process()
+{
+    while (!m_complete && !m_failed) {
+        switch (m_reader.readNext()) {
+        case QXmlStreamReader::StartElement:
+            startElement();
+            addToFingerprint();
+            break;
+        case QXmlStreamReader::EndElement:
+            // before endElement(), which finishes the item on its end tag
+            addToFingerprint();
+            endElement();
+            break;
+        case QXmlStreamReader::Characters:
+            addToFingerprint();
+            characters();
+            break;
+        case QXmlStreamReader::Comment:
+        case QXmlStreamReader::ProcessingInstruction:
+        case QXmlStreamReader::EntityReference:
+            otherToken();
+            break;
+        case QXmlStreamReader::Invalid:
+            // running out of data is not an error, parsing resumes with the next chunk
+            if (m_reader.error() != QXmlStreamReader::PrematureEndOfDocumentError) {
+                m_failed = true;
+            }
+            return;
+        case QXmlStreamReader::EndDocument:
+            return;
+        default:
+            break;
+        }
+    }
+}
+
+void StreamReader::startElement()
+{
+    ++m_depth;
+
+    if (m_childDepth != 0) {
+        // somewhere below a channel or item child
+        m_firstTokenPending = false;
+        writeToCaptures();
+        return;
+    }
+
+    const QStringView ns = m_reader.namespaceUri();
+    const QStringView name = m_reader.name();
+
+    switch (m_container) {
+    case NoContainer:
+        // Document::fromXML() matches the qualified names of rss and channel
+        if (m_reader.qualifiedName() != QLatin1String("rss")) {
+            m_failed = true;
+            return;
+        }
+        m_container = InRoot;
+        return;
+    case InRoot:
+        if (!m_channelSeen && m_reader.qualifiedName() == QLatin1String("channel")) {
+            m_channelSeen = true;
+            m_container = InChannel;
+            return;
+        }
+        break;
+    case InChannel:
+        if (ns.isEmpty() && name == QLatin1String("item")) {
+            m_item = PendingItem();
+            m_container = InItem;
+            return;
+        }
+        if (ns.isEmpty() && name == QLatin1String("image")) {
+            if (!m_imageSeen) {
+                m_imageSeen = true;
+                m_channel.image.isNull = false;
+                m_container = InImage;
+                return;
+            }
+            break;
+        }
+        m_field = channelField();
+        if (!handledChannelElements.contains(ns, name)) {
+            m_unhandledKey = ns.toString() + name.toString();
+            startCapture(m_unhandled);
+        }
+        break;
+    case InItem:
+        m_field = itemField();
+        if (m_field != NoField && m_field != ItemCategory && (m_item.seen & fieldBit(m_field))) {
+            // like the DOM accessors, only the first element of a kind counts
+            m_field = NoField;
+        }
+        if (m_field == ItemGuid) {
+            m_item.record.guidIsPermaLink = m_reader.attributes().value(QLatin1String("isPermaLink")) != QLatin1String("false");
+        } else if (m_field == ItemXhtmlBody || m_field == ItemXhtmlDiv) {
+            startCapture(m_content);
+        } else if (ns.isEmpty() && name == QLatin1String("enclosure")) {
+            const QXmlStreamAttributes attributes = m_reader.attributes();
+            StreamEnclosure enclosure;
+            enclosure.url = attributeValue(attributes, QLatin1String("url"));
+            enclosure.type = attributeValue(attributes, QLatin1String("type"));
+            bool ok = false;
+            const int length = attributes.value(QLatin1String("length")).toInt(&ok);
+            enclosure.length = ok ? length : 0;
+            m_item.record.enclosures.append(enclosure);
+        }
+        if (!handledItemElements.contains(ns, name)) {
+            m_unhandledKey = ns.toString() + name.toString();
+            startCapture(m_unhandled);
+        }
+        break;
+    case InImage:
+        m_field = imageField();
+        break;
+    }
+
+    if (m_field != NoField && m_field != ChannelCategory && m_field < ItemTitle && (m_channelSeenFields & fieldBit(m_field))) {
+        m_field = NoField;
+    }
+    if (m_field == ChannelCategory || m_field == ItemCategory) {
+        m_categoryDomain = attributeValue(m_reader.attributes(), QLatin1String("domain"));
+    }
+
+    m_childDepth = m_depth;
+    m_text = QString();
+    m_firstTokenPending = true;
+    m_firstTokenIsCDATA = false;
+
+    if (m_unhandled.isActive()) {
+        m_unhandled.writer->writeCurrentToken(m_reader);
+    }
+}
+
+void StreamReader::endElement()
+{
+    const int depth = m_depth--;
+
+    if (m_childDepth != 0 && depth > m_childDepth) {
+        writeToCaptures();
+        return;
+    }
+
+    if (depth == m_childDepth) {
+        if (m_unhandled.isActive()) {
+            m_unhandled.writer->writeCurrentToken(m_reader);
+            m_unhandled.writer.reset();
+            StreamElement element;
+            element.key = m_unhandledKey;
+            element.xml = m_unhandled.buffer;
+            m_unhandled.buffer = QString();
+            if (m_container == InItem) {
+                m_item.record.unhandled.append(element);
+            } else {
+                m_channel.unhandled.append(element);
+            }
+        }
+        if (m_content.isActive()) {
+            m_content.writer.reset();
+            m_text = m_content.buffer;
+            m_content.buffer = QString();
+        }
+        finishField();
+        m_field = NoField;
+        m_childDepth = 0;
+        return;
+    }
+
+    switch (m_container) {
+    case InItem:
+        finishItem();
+        m_container = InChannel;
+        break;
+    case InImage:
+        m_container = InChannel;
+        break;
+    case InChannel:
+        m_container = InRoot;
+        break;
+    case InRoot:
+        m_container = NoContainer;
+        m_complete = true;
+        break;
+    case NoContainer:
+        break;
+    }
+}
+
+void StreamReader::characters()
+{
+    // QDomDocument drops whitespace-only text nodes, do the same so
+    // the text accessors and serialized elements match the DOM parser
+    if (m_childDepth == 0 || m_reader.isWhitespace()) {
+        return;
+    }
+
+    if (m_firstTokenPending) {
+        m_firstTokenPending = false;
+        m_firstTokenIsCDATA = m_reader.isCDATA();
+    }
+    if (m_field != NoField && !m_content.isActive()) {
+        m_text += m_reader.text();
+    }
+    writeToCaptures();
+}
+
+void StreamReader::otherToken()
+{
+    if (m_childDepth == 0) {
+        return;
+    }
+    m_firstTokenPending = false;
+    writeToCaptures();
+}
+
+void StreamReader::addToFingerprint()
+{
+    if (m_container != InItem) {
+        return;
+    }
+
+    FingerprintBuilder &fingerprint = m_item.fingerprint;
+    if (m_reader.isStartElement()) {
+        const QXmlStreamAttributes attributes = m_reader.attributes();
+        QStringList list;
+        list.reserve(attributes.size());
+        for (const QXmlStreamAttribute &attribute : attributes) {
+            list.append(FingerprintBuilder::attribute(attribute.namespaceUri(), attribute.name(), attribute.value()));
+        }
+        fingerprint.startElement(m_reader.namespaceUri(), m_reader.name(), list);
+    } else if (m_reader.isEndElement()) {
+        fingerprint.endElement();
+    } else {
+        fingerprint.characters(m_reader.text());
+    }
+}
+
+StreamReader::FieldId StreamReader::channelField() const
+{
+    const QStringView ns = m_reader.namespaceUri();
+    const QStringView name = m_reader.name();
+
+    if (ns.isEmpty()) {
+        if (name == QLatin1String("title")) {
+            return ChannelTitle;
+        } else if (name == QLatin1String("link")) {
+            return ChannelLink;
+        } else if (name == QLatin1String("description")) {
+            return ChannelDescription;
+        } else if (name == QLatin1String("language")) {
+            return ChannelLanguage;
+        } else if (name == QLatin1String("copyright")) {
+            return ChannelCopyright;
+        } else if (name == QLatin1String("category")) {
+            return ChannelCategory;
+        }
+    } else if (ns == m_dcNs) {
+        if (name == QLatin1String("language")) {
+            return ChannelDcLanguage;
+        } else if (name == QLatin1String("rights")) {
+            return ChannelDcRights;
+        }
+    }
+    return NoField;
+}
+
+StreamReader::FieldId StreamReader::imageField() const
+{
+    if (!m_reader.namespaceUri().isEmpty()) {
+        return NoField;
+    }
+
+    const QStringView name = m_reader.name();
+    if (name == QLatin1String("url")) {
+        return ImageUrl;
+    } else if (name == QLatin1String("title")) {
+        return ImageTitle;
+    } else if (name == QLatin1String("link")) {
+        return ImageLink;
+    } else if (name == QLatin1String("description")) {
+        return ImageDescription;
+    } else if (name == QLatin1String("width")) {
+        return ImageWidth;
+    } else if (name == QLatin1String("height")) {
+        return ImageHeight;
+    }
+    return NoField;
+}
+
+StreamReader::FieldId StreamReader::itemField() const
+{
+    const QStringView ns = m_reader.namespaceUri();
+    const QStringView name = m_reader.name();
+
+    if (ns.isEmpty()) {
+        if (name == QLatin1String("title")) {
+            return ItemTitle;
+        } else if (name == QLatin1String("link")) {
+            return ItemLink;
+        } else if (name == QLatin1String("description")) {
+            return ItemDescription;
+        } else if (name == QLatin1String("comments")) {
+            return ItemComments;
+        } else if (name == QLatin1String("author")) {
+            return ItemAuthor;
+        } else if (name == QLatin1String("guid")) {
+            return ItemGuid;
+        } else if (name == QLatin1String("pubDate")) {
+            return ItemPubDate;
+        } else if (name == QLatin1String("category")) {
+            return ItemCategory;
+        }
+    } else if (ns == m_dcNs) {
+        if (name == QLatin1String("creator")) {
+            return ItemDcCreator;
+        } else if (name == QLatin1String("date")) {
+            return ItemDcDate;
+        }
+    } else if (ns == m_contentNs) {
+        if (name == QLatin1String("encoded")) {
+            return ItemContentEncoded;
+        }
+    } else if (ns == m_xhtmlNs) {
+        if (name == QLatin1String("body")) {
+            return ItemXhtmlBody;
+        } else if (name == QLatin1String("div")) {
+            return ItemXhtmlDiv;
+        }
+    } else if (ns == m_slashNs) {
+        if (name == QLatin1String("comments")) {
+            return ItemSlashComments;
+        }
+    } else if (ns == m_commentApiNs) {
+        if (name == QLatin1String("commentRss")) {
+            return ItemCommentRss;
+        } else if (name == QLatin1String("commentRSS")) {
+            return ItemCommentRSS;
+        } else if (name == QLatin1String("comment")) {
+            return ItemCommentPostUri;
+        }
+    } else if (ns == m_itunesNs) {
+        if (name == QLatin1String("duration")) {
+            return ItemDuration;
+        }
+    } else if (ns == m_atomNs) {
+        if (name == QLatin1String("updated")) {
+            return ItemAtomUpdated;
+        }
+    }
+    return NoField;
+}
+
+void StreamReader::startCapture(Capture &capture)
+{
+    capture.buffer = QString();
+    capture.writer.reset(new QXmlStreamWriter(&capture.buffer));
+}
+
+void StreamReader::writeToCaptures()
+{
+    if (m_unhandled.isActive()) {
+        m_unhandled.writer->writeCurrentToken(m_reader);
+    }
+    if (m_content.isActive()) {
+        // content is embedded as markup, keep the tag names as written
+        // instead of emitting generated namespace prefixes
+        if (m_reader.isStartElement()) {
+            m_content.writer->writeStartElement(m_reader.qualifiedName().toString());
+            m_content.writer->writeAttributes(m_reader.attributes());
+        } else if (m_reader.isEndElement()) {
+            m_content.writer->writeEndElement();
+        } else {
+            m_content.writer->writeCurrentToken(m_reader);
+        }
+    }
+}
+
+void StreamReader::finishField()
+{
+    if (m_field == NoField) {
+        return;
+    }
+
+    if (m_field == ChannelCategory || m_field == ItemCategory) {
+        StreamCategory category;
+        category.category = m_text.simplified();
+        category.domain = m_categoryDomain;
+        if (m_field == ChannelCategory) {
+            m_channel.categories.append(category);
+        } else {
+            m_item.record.categories.append(category);
+        }
+        return;
+    }
+
+    const QString text = m_text.trimmed();
+    ItemRecord &item = m_item.record;
+    StreamImage &image = m_channel.image;
+    bool ok = false;
+
+    if (m_field < ItemTitle) {
+        m_channelSeenFields |= fieldBit(m_field);
+    } else {
+        m_item.seen |= fieldBit(m_field);
+    }
+
+    switch (m_field) {
+    case ChannelTitle:
+        m_channel.title = text;
+        break;
+    case ChannelLink:
+        m_channel.link = text;
+        break;
+    case ChannelDescription:
+        m_channel.description = text;
+        break;
+    case ChannelLanguage:
+        m_channel.language = text;
+        break;
+    case ChannelDcLanguage:
+        m_channelDcLanguage = text;
+        break;
+    case ChannelCopyright:
+        m_channel.copyright = text;
+        break;
+    case ChannelDcRights:
+        m_channelDcRights = text;
+        break;
+    case ImageUrl:
+        image.url = text;
+        break;
+    case ImageTitle:
+        image.title = text;
+        break;
+    case ImageLink:
+        image.link = text;
+        break;
+    case ImageDescription:
+        image.description = text;
+        break;
+    case ImageWidth: {
+        const uint width = text.toUInt(&ok);
+        image.width = ok ? width : 88;
+        break;
+    }
+    case ImageHeight: {
+        const uint height = text.toUInt(&ok);
+        image.height = ok ? height : 31;
+        break;
+    }
+    case ItemTitle:
+        item.title = text;
+        m_item.titleIsCDATA = m_firstTokenIsCDATA;
+        break;
+    case ItemLink:
+        item.link = text;
+        break;
+    case ItemDescription:
+        item.description = text;
+        m_item.descriptionIsCDATA = m_firstTokenIsCDATA;
+        break;
+    case ItemComments:
+        item.comments = text;
+        break;
+    case ItemAuthor:
+        item.author = text;
+        break;
+    case ItemDcCreator:
+        m_item.dcCreator = text;
+        break;
+    case ItemGuid:
+        item.guid = text;
+        break;
+    case ItemPubDate:
+        m_item.pubDate = text;
+        break;
+    case ItemDcDate:
+        m_item.dcDate = text;
+        break;
+    case ItemAtomUpdated:
+        m_item.updated = text;
+        break;
+    case ItemContentEncoded:
+        m_item.encoded = text;
+        break;
+    case ItemXhtmlBody:
+        m_item.xhtmlBody = text;
+        break;
+    case ItemXhtmlDiv:
+        m_item.xhtmlDiv = text;
+        break;
+    case ItemSlashComments:
+        item.slashComments = text;
+        break;
+    case ItemCommentRss:
+        item.commentRss = text;
+        break;
+    case ItemCommentRSS:
+        m_item.commentRSS = text;
+        break;
+    case ItemCommentPostUri:
+        item.commentPostUri = text;
+        break;
+    case ItemDuration:
+        item.duration = text;
+        break;
+    default:
+        break;
+    }
+}
+
+void StreamReader::finishItem()
+{
+    ItemRecord &item = m_item.record;
+
+    // same fallbacks as the Item accessors and ItemRSS2Impl
+    if (item.author.isNull()) {
+        item.author = m_item.dcCreator;
+    }
+    if (!m_item.pubDate.isNull()) {
+        item.pubDate = parseDate(m_item.pubDate, RFCDate);
+    } else {
+        item.pubDate = parseDate(m_item.dcDate, ISODate);
+    }
+    item.updated = m_item.updated.isEmpty() ? item.pubDate : parseDate(m_item.updated, ISODate);
+    if (m_item.seen & fieldBit(ItemContentEncoded)) {
+        item.content = m_item.encoded;
+    } else if (m_item.seen & fieldBit(ItemXhtmlBody)) {
+        item.content = m_item.xhtmlBody;
+    } else if (m_item.seen & fieldBit(ItemXhtmlDiv)) {
+        item.content = m_item.xhtmlDiv;
+    }
+    if (item.commentRss.isNull()) {
+        item.commentRss = m_item.commentRSS;
+    }
+    item.fingerprint = m_item.fingerprint.digest();
+    // before finishDocument() resolves the link and normalizes the title
+    item.identity = identityDigest({item.guid, item.link, item.title}, item.fingerprint);
+
+    // the feed-wide format guess looks at the first ten items
+    if (m_items.isEmpty()) {
+        m_itemTitleIsCDATA = m_item.titleIsCDATA;
+        m_itemDescriptionIsCDATA = m_item.descriptionIsCDATA;
+    }
+    if (m_items.size() < 10) {
+        m_titles += item.title;
+        m_descriptions += item.description;
+    }
+
+    m_items.append(item);
+    m_item = PendingItem();
+}
+
+void StreamReader::finishDocument()
+{
+    m_channel.description = normalize(m_channel.description);
+    if (m_channel.language.isNull()) {
+        m_channel.language = m_channelDcLanguage;
+    }
+    if (m_channel.copyright.isNull()) {
+        m_channel.copyright = m_channelDcRights;
+    }
+
+    const bool titlesContainMarkup = stringContainsMarkup(m_titles);
+    const bool descriptionsContainMarkup = stringContainsMarkup(m_descriptions);
+    const QString &baseUrl = m_channel.link;
+
+    for (ItemRecord &item : m_items) {
+        item.title = normalize(item.title, m_itemTitleIsCDATA, titlesContainMarkup);
+        item.description = normalize(item.description, m_itemDescriptionIsCDATA, descriptionsContainMarkup);
+
+        // see Item::link()
+        const QString url = item.link;
+        if (url.isEmpty()) {
+            item.link = QString();
+        } else if (url.startsWith(QLatin1String("http://")) || url.startsWith(QLatin1String("https://")) || baseUrl.isEmpty()) {
+            continue;
+        } else if (url.startsWith(QLatin1Char('/')) || baseUrl.endsWith(QLatin1Char('/'))) {
+            item.link = baseUrl + url;
+        } else {
+            item.link = baseUrl + QLatin1Char('/') + url;
+        }
+    }
+}
+//@endcond
+
+} // namespace RSS2
+} // namespace Syndication
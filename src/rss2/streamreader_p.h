@@ -0,0 +1,213 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_RSS2_STREAMREADER_P_H
+#define SYNDICATION_RSS2_STREAMREADER_P_H
+
+#include <feeddiff_p.h>
+#include <rss2/streamdocument.h>
+
+#include <QList>
+#include <QString>
+#include <QXmlStreamReader>
+
+#include <memory>
+
+class QByteArray;
+class QXmlStreamWriter;
+
+namespace Syndication
+{
+namespace RSS2
+{
+//@cond PRIVATE
+/*!
+ * \internal
+ *
+ * Single-pass RSS 0.9x/2.0 reader on top of QXmlStreamReader.
+ *
+ * The reader is driven purely by tokens and keeps all of its state in
+ * members, so data can be fed in arbitrary chunks via addData(); tokens
+ * are processed as far as the data available allows. Call finish() once
+ * all data has been added to obtain the document.
+ */
+class StreamReader
+{
+public:
+    StreamReader();
+    ~StreamReader();
+
+    /*!
+     * appends \a data to the input and processes all complete tokens
+     */
+    void addData(const QByteArray &data);
+
+    /*!
+     * Returns \c true if the input is not well-formed XML or not an RSS
+     * document. Once this happens, further data is ignored.
+     */
+    bool hasError() const;
+
+    /*!
+     * Returns \c true if the root element was closed, i.e. the complete
+     * document has been read.
+     */
+    bool isComplete() const;
+
+    /*!
+     * Finishes reading and returns the document, or an invalid document if
+     * the input was malformed, truncated or not RSS.
+     */
+    StreamDocumentPtr finish();
+
+    /*!
+     * Checks whether the root element of \a data is an RSS root element
+     * (\c &lt;rss>), reading no further than the root start tag.
+     */
+    static bool isRssDocument(const QByteArray &data);
+
+private:
+    enum Container {
+        NoContainer,
+        InRoot,
+        InChannel,
+        InItem,
+        InImage,
+    };
+
+    enum FieldId {
+        NoField,
+        // channel fields
+        ChannelTitle,
+        ChannelLink,
+        ChannelDescription,
+        ChannelLanguage,
+        ChannelDcLanguage,
+        ChannelCopyright,
+        ChannelDcRights,
+        ChannelCategory,
+        // image fields
+        ImageUrl,
+        ImageTitle,
+        ImageLink,
+        ImageDescription,
+        ImageWidth,
+        ImageHeight,
+        // item fields
+        ItemTitle,
+        ItemLink,
+        ItemDescription,
+        ItemComments,
+        ItemAuthor,
+        ItemDcCreator,
+        ItemGuid,
+        ItemPubDate,
+        ItemDcDate,
+        ItemAtomUpdated,
+        ItemContentEncoded,
+        ItemXhtmlBody,
+        ItemXhtmlDiv,
+        ItemCategory,
+        ItemSlashComments,
+        ItemCommentRss,
+        ItemCommentRSS,
+        ItemCommentPostUri,
+        ItemDuration,
+    };
+
+    /*
+     * Serializes the tokens of a subtree while it is read. An "inner"
+     * capture leaves out the start and end tag of the subtree root.
+     */
+    struct Capture {
+        QString buffer;
+        std::unique_ptr<QXmlStreamWriter> writer;
+
+        bool isActive() const
+        {
+            return writer != nullptr;
+        }
+    };
+
+    struct PendingItem {
+        ItemRecord record;
+        QString dcCreator;
+        QString pubDate;
+        QString dcDate;
+        QString updated;
+        QString encoded;
+        QString xhtmlBody;
+        QString xhtmlDiv;
+        QString commentRSS;
+        bool titleIsCDATA = false;
+        bool descriptionIsCDATA = false;
+        quint64 seen = 0; // bit set of the FieldIds read so far
+        FingerprintBuilder fingerprint;
+    };
+
+    void process();
+    void startElement();
+    void endElement();
+    void characters();
+    void otherToken();
+    void addToFingerprint();
+
+    FieldId channelField() const;
+    FieldId imageField() const;
+    FieldId itemField() const;
+
+    void startCapture(Capture &capture);
+    void writeToCaptures();
+    void finishField();
+    void finishItem();
+    void finishDocument();
+
+    QXmlStreamReader m_reader;
+
+    Container m_container = NoContainer;
+    int m_depth = 0;
+    int m_childDepth = 0; // depth of the container child being read, 0 if none
+    bool m_complete = false;
+    bool m_failed = false;
+    bool m_channelSeen = false;
+    bool m_imageSeen = false;
+
+    FieldId m_field = NoField;
+    QString m_text;
+    bool m_firstTokenPending = false;
+    bool m_firstTokenIsCDATA = false;
+    QString m_categoryDomain;
+
+    Capture m_unhandled;
+    QString m_unhandledKey;
+    Capture m_content;
+
+    ChannelRecord m_channel;
+    QString m_channelDcLanguage;
+    QString m_channelDcRights;
+    quint64 m_channelSeenFields = 0;
+    PendingItem m_item;
+    QList<ItemRecord> m_items;
+    QString m_titles;
+    QString m_descriptions;
+    bool m_itemTitleIsCDATA = false;
+    bool m_itemDescriptionIsCDATA = false;
+
+    const QString m_dcNs;
+    const QString m_contentNs;
+    const QString m_xhtmlNs;
+    const QString m_slashNs;
+    const QString m_commentApiNs;
+    const QString m_itunesNs;
+    const QString m_atomNs;
+};
+//@endcond
+
+} // namespace RSS2
+} // namespace Syndication
+
+#endif // SYNDICATION_RSS2_STREAMREADER_P_H
@@ -17,8 +17,12 @@
 #include <syndication/elementwrapper.h>
 #include <syndication/enclosure.h>
 #include <syndication/feed.h>
+#include <syndication/feeddiff.h>
+#include <syndication/feedsnapshot.h>
 #include <syndication/global.h>
 #include <syndication/image.h>
+#include <syndication/incrementalparser.h>
+#include <syndication/instrumentation.h>
 #include <syndication/item.h>
 #include <syndication/loader.h>
 #include <syndication/mapper.h>
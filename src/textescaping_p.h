@@ -0,0 +1,48 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_TEXTESCAPING_P_H
+#define SYNDICATION_TEXTESCAPING_P_H
+
+#include <QFlags>
+#include <QString>
+
+namespace Syndication
+{
+//@cond PRIVATE
+/*!
+ * \internal
+ * steps of escapeText(), in addition to escaping special characters
+ */
+enum TextEscapeOption {
+    /*! resolves entities before escaping, like resolveEntities() */
+    ResolveEntities = 0x1,
+    /*! replaces line breaks by <br/>, like convertNewlines() */
+    ConvertNewlines = 0x2,
+    /*!
+     * escapes &, " and < only, and trims after converting line breaks,
+     * like plainTextToHtml()
+     */
+    PlainTextToHtml = 0x4,
+};
+Q_DECLARE_FLAGS(TextEscapeOptions, TextEscapeOption)
+Q_DECLARE_OPERATORS_FOR_FLAGS(TextEscapeOptions)
+
+/*!
+ * \internal
+ *
+ * Escapes \a str for use in HTML in a single pass. Without options, the result
+ * equals escapeSpecialCharacters(str). With \c ResolveEntities and
+ * \c ConvertNewlines, it equals
+ * convertNewlines(escapeSpecialCharacters(resolveEntities(str))).
+ */
+QString escapeText(QStringView str, TextEscapeOptions options = {});
+//@endcond
+
+} // namespace Syndication
+
+#endif // SYNDICATION_TEXTESCAPING_P_H
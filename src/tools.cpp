@@ -7,21 +7,21 @@
 
 #include "tools.h"
 #include "personimpl.h"
+#include "textescaping_p.h"
 
 #include <KCharsets>
 
 #include <QByteArray>
 #include <QCryptographicHash>
 #include <QDateTime>
-#include <QRegularExpression>
 #include <QTimeZone>
+#include <QtEndian>
 
 #include <ctime>
+#include <limits>
 
 namespace Syndication
 {
-QCryptographicHash md5Machine(QCryptographicHash::Md5);
-
 unsigned int calcHash(const QString &str)
 {
     return calcHash(str.toUtf8());
@@ -32,16 +32,412 @@ unsigned int calcHash(const QByteArray &array)
     if (array.isEmpty()) {
         return 0;
     } else {
-        const char *s = array.data();
+        // all bytes, embedded NULs included
         unsigned int hash = 5381;
-        int c;
-        while ((c = *s++)) {
+        for (const char c : array) {
             hash = ((hash << 5) + hash) + c; // hash*33 + c
         }
         return hash;
     }
 }
 
+namespace
+{
+// XXH64, see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+constexpr quint64 prime1 = 11400714785074694791ULL;
+constexpr quint64 prime2 = 14029467366897019727ULL;
+constexpr quint64 prime3 = 1609587929392839161ULL;
+constexpr quint64 prime4 = 9650029242287828579ULL;
+constexpr quint64 prime5 = 2870177450012600261ULL;
+
+inline quint64 rotateLeft(quint64 value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline quint64 digestRound(quint64 accumulator, quint64 input)
+{
+    accumulator += input * prime2;
+    accumulator = rotateLeft(accumulator, 31);
+    return accumulator * prime1;
+}
+
+inline quint64 mergeRound(quint64 accumulator, quint64 value)
+{
+    accumulator ^= digestRound(0, value);
+    return accumulator * prime1 + prime4;
+}
+} // namespace
+
+quint64 calcDigest(const QByteArray &array)
+{
+    const uchar *p = reinterpret_cast<const uchar *>(array.constData());
+    const uchar *const end = p + array.size();
+    quint64 hash;
+
+    if (array.size() >= 32) {
+        // four independent lanes, which the compiler can keep in flight at once
+        quint64 v1 = prime1 + prime2;
+        quint64 v2 = prime2;
+        quint64 v3 = 0;
+        quint64 v4 = 0 - prime1;
+        for (; p + 32 <= end; p += 32) {
+            v1 = digestRound(v1, qFromLittleEndian<quint64>(p));
+            v2 = digestRound(v2, qFromLittleEndian<quint64>(p + 8));
+            v3 = digestRound(v3, qFromLittleEndian<quint64>(p + 16));
+            v4 = digestRound(v4, qFromLittleEndian<quint64>(p + 24));
+        }
+        hash = rotateLeft(v1, 1) + rotateLeft(v2, 7) + rotateLeft(v3, 12) + rotateLeft(v4, 18);
+        hash = mergeRound(hash, v1);
+        hash = mergeRound(hash, v2);
+        hash = mergeRound(hash, v3);
+        hash = mergeRound(hash, v4);
+    } else {
+        hash = prime5;
+    }
+
+    hash += quint64(array.size());
+
+    for (; p + 8 <= end; p += 8) {
+        hash ^= digestRound(0, qFromLittleEndian<quint64>(p));
+        hash = rotateLeft(hash, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        hash ^= quint64(qFromLittleEndian<quint32>(p)) * prime1;
+        hash = rotateLeft(hash, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        hash ^= *p * prime5;
+        hash = rotateLeft(hash, 11) * prime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+namespace
+{
+// Minimal cursor over a date string. All scanning functions leave the
+// position untouched when they fail, so alternatives can be tried in turn.
+class DateScanner
+{
+public:
+    explicit DateScanner(QStringView str)
+        : m_str(str)
+    {
+    }
+
+    bool atEnd() const
+    {
+        return m_pos == m_str.size();
+    }
+
+    bool skipChar(char16_t c)
+    {
+        if (m_pos < m_str.size() && m_str.at(m_pos) == c) {
+            ++m_pos;
+            return true;
+        }
+        return false;
+    }
+
+    // skips at least one space or tab
+    bool skipBlanks()
+    {
+        const qsizetype start = m_pos;
+        while (m_pos < m_str.size() && (m_str.at(m_pos) == u' ' || m_str.at(m_pos) == u'\t')) {
+            ++m_pos;
+        }
+        return m_pos > start;
+    }
+
+    // reads between minDigits and maxDigits decimal digits
+    bool readNumber(int minDigits, int maxDigits, int *value, int *digits = nullptr)
+    {
+        int n = 0;
+        int count = 0;
+        while (count < maxDigits && m_pos + count < m_str.size()) {
+            const char16_t c = m_str.at(m_pos + count).unicode();
+            if (c < u'0' || c > u'9') {
+                break;
+            }
+            n = n * 10 + (c - u'0');
+            ++count;
+        }
+        if (count < minDigits) {
+            return false;
+        }
+        m_pos += count;
+        *value = n;
+        if (digits) {
+            *digits = count;
+        }
+        return true;
+    }
+
+    // reads a run of ASCII letters
+    QStringView readWord()
+    {
+        const qsizetype start = m_pos;
+        while (m_pos < m_str.size()) {
+            const char16_t c = m_str.at(m_pos).unicode();
+            if ((c < u'a' || c > u'z') && (c < u'A' || c > u'Z')) {
+                break;
+            }
+            ++m_pos;
+        }
+        return m_str.mid(start, m_pos - start);
+    }
+
+private:
+    QStringView m_str;
+    qsizetype m_pos = 0;
+};
+
+// days since 1970-01-01 of a proleptic Gregorian date, see
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+qint64 daysFromCivil(int year, int month, int day)
+{
+    const qint64 y = month <= 2 ? year - 1 : year;
+    const qint64 era = (y >= 0 ? y : y - 399) / 400;
+    const qint64 yoe = y - era * 400;
+    const qint64 doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const qint64 doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+bool isValidDate(int year, int month, int day)
+{
+    static const int daysInMonth[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth[month - 1]) {
+        return false;
+    }
+    const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return month != 2 || day <= 28 || leap;
+}
+
+// converts the broken-down UTC time to the value returned by the parse
+// functions; values outside the range of uint are left to QDateTime
+bool toEpoch(int year, int month, int day, int hour, int minute, int second, int offsetSeconds, uint *result)
+{
+    const qint64 secs = daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offsetSeconds;
+    if (secs <= 0 || secs > qint64(std::numeric_limits<uint>::max())) {
+        return false;
+    }
+    *result = uint(secs);
+    return true;
+}
+
+int monthFromName(QStringView name)
+{
+    static const char months[][4] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+    if (name.size() != 3) {
+        return 0;
+    }
+    for (int i = 0; i < 12; ++i) {
+        if (name.compare(QLatin1String(months[i], 3), Qt::CaseInsensitive) == 0) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+// returns the ISO day of week (Monday is 1), or 0 for an unknown name
+int dayOfWeekFromName(QStringView name)
+{
+    static const char days[][4] = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+    if (name.size() != 3) {
+        return 0;
+    }
+    for (int i = 0; i < 7; ++i) {
+        if (name.compare(QLatin1String(days[i], 3), Qt::CaseInsensitive) == 0) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+// textual zones of RFC 822, returns false for unknown names
+bool offsetFromZoneName(QStringView name, int *offsetSeconds)
+{
+    struct Zone {
+        const char *name;
+        int hours;
+    };
+    static const Zone zones[] = {
+        {"GMT", 0},
+        {"UT", 0},
+        {"UTC", 0},
+        {"Z", 0},
+        {"EST", -5},
+        {"EDT", -4},
+        {"CST", -6},
+        {"CDT", -5},
+        {"MST", -7},
+        {"MDT", -6},
+        {"PST", -8},
+        {"PDT", -7},
+    };
+    for (const Zone &zone : zones) {
+        if (name.compare(QLatin1String(zone.name), Qt::CaseInsensitive) == 0) {
+            *offsetSeconds = zone.hours * 3600;
+            return true;
+        }
+    }
+    // RFC 2822 4.3: the meaning of the military zones is ambiguous and they
+    // are to be treated as -0000
+    if (name.size() == 1 && name.at(0).toLower() != u'j') {
+        *offsetSeconds = 0;
+        return true;
+    }
+    return false;
+}
+
+// reads a numeric offset, "+hhmm" or "+hh:mm"
+bool readNumericOffset(DateScanner &s, bool colonAllowed, int *offsetSeconds)
+{
+    int sign = 1;
+    if (s.skipChar(u'-')) {
+        sign = -1;
+    } else if (!s.skipChar(u'+')) {
+        return false;
+    }
+    int hours;
+    int minutes;
+    if (!s.readNumber(2, 2, &hours)) {
+        return false;
+    }
+    if (colonAllowed) {
+        s.skipChar(u':');
+    }
+    if (!s.readNumber(2, 2, &minutes) || hours > 14 || minutes > 59) {
+        return false;
+    }
+    *offsetSeconds = sign * (hours * 3600 + minutes * 60);
+    return true;
+}
+
+// RFC 822/2822 dates as used by RSS, e.g. "Sat, 07 Sep 2002 00:00:01 GMT".
+// Returns false for everything it does not fully understand, leaving those to QDateTime.
+bool fastParseRFCDate(QStringView str, uint *result)
+{
+    DateScanner s(str);
+    s.skipBlanks();
+
+    int dayOfWeek = 0;
+    const QStringView dayName = s.readWord();
+    if (!dayName.isEmpty()) {
+        dayOfWeek = dayOfWeekFromName(dayName);
+        if (dayOfWeek == 0 || !s.skipChar(u',')) {
+            return false;
+        }
+        s.skipBlanks();
+    }
+
+    int day;
+    int year;
+    int yearDigits;
+    if (!s.readNumber(1, 2, &day) || !s.skipBlanks()) {
+        return false;
+    }
+    const int month = monthFromName(s.readWord());
+    if (month == 0 || !s.skipBlanks() || !s.readNumber(2, 4, &year, &yearDigits) || yearDigits == 3) {
+        return false;
+    }
+    if (yearDigits == 2) {
+        // obsolete two-digit years, RFC 2822 4.3
+        year += year < 50 ? 2000 : 1900;
+    }
+
+    int hour;
+    int minute;
+    int second = 0;
+    if (!s.skipBlanks() || !s.readNumber(2, 2, &hour) || !s.skipChar(u':') || !s.readNumber(2, 2, &minute)) {
+        return false;
+    }
+    if (s.skipChar(u':') && !s.readNumber(2, 2, &second)) {
+        return false;
+    }
+    if (hour > 23 || minute > 59 || second > 59 || !isValidDate(year, month, day)) {
+        return false;
+    }
+
+    int offset = 0;
+    if (s.skipBlanks() && !s.atEnd()) {
+        if (!readNumericOffset(s, false, &offset) && !offsetFromZoneName(s.readWord(), &offset)) {
+            return false;
+        }
+        s.skipBlanks();
+    }
+    if (!s.atEnd()) {
+        return false;
+    }
+
+    // 1970-01-01 was a Thursday
+    if (dayOfWeek != 0 && (daysFromCivil(year, month, day) % 7 + 7 + 3) % 7 + 1 != dayOfWeek) {
+        return false;
+    }
+    return toEpoch(year, month, day, hour, minute, second, offset, result);
+}
+
+// ISO 8601 dates as used by Atom and Dublin Core, e.g. "2003-12-13T18:30:02Z".
+// Returns false for everything it does not fully understand, leaving those to QDateTime.
+bool fastParseISODate(QStringView str, uint *result)
+{
+    DateScanner s(str);
+    int year;
+    int month;
+    int day;
+    if (!s.readNumber(4, 4, &year) || !s.skipChar(u'-') || !s.readNumber(2, 2, &month) || !s.skipChar(u'-') || !s.readNumber(2, 2, &day)
+        || !isValidDate(year, month, day)) {
+        return false;
+    }
+    if (s.atEnd()) {
+        // date-only timestamps are taken as 12:00 UTC, see toTimeT()
+        return toEpoch(year, month, day, 12, 0, 0, 0, result);
+    }
+
+    int hour;
+    int minute;
+    int second = 0;
+    int fraction = 0;
+    if (!s.skipChar(u'T') || !s.readNumber(2, 2, &hour) || !s.skipChar(u':') || !s.readNumber(2, 2, &minute)) {
+        return false;
+    }
+    if (s.skipChar(u':')) {
+        if (!s.readNumber(2, 2, &second)) {
+            return false;
+        }
+        // whole seconds only, so milliseconds do not change the result
+        if ((s.skipChar(u'.') || s.skipChar(u',')) && !s.readNumber(1, 3, &fraction)) {
+            return false;
+        }
+    }
+    if (hour > 23 || minute > 59 || second > 59) {
+        return false;
+    }
+
+    int offset = 0;
+    if (s.atEnd()) {
+        // no offset means local time, which only QDateTime knows about,
+        // except for midnight, which toTimeT() moves to 12:00 UTC
+        if (hour != 0 || minute != 0 || second != 0 || fraction != 0) {
+            return false;
+        }
+        return toEpoch(year, month, day, 12, 0, 0, 0, result);
+    }
+    if (!s.skipChar(u'Z') && !readNumericOffset(s, true, &offset)) {
+        return false;
+    }
+    return s.atEnd() && toEpoch(year, month, day, hour, minute, second, offset, result);
+}
+} // namespace
+
 static uint toTimeT(QDateTime &kdt)
 {
     if (kdt.isValid()) {
@@ -59,12 +455,20 @@ static uint toTimeT(QDateTime &kdt)
 
 uint parseISODate(const QString &str)
 {
+    uint result;
+    if (fastParseISODate(str, &result)) {
+        return result;
+    }
     QDateTime kdt = QDateTime::fromString(str, Qt::ISODate);
     return toTimeT(kdt);
 }
 
 uint parseRFCDate(const QString &str)
 {
+    uint result;
+    if (fastParseRFCDate(str, &result)) {
+        return result;
+    }
     QDateTime kdt = QDateTime::fromString(str, Qt::RFC2822Date);
     // Qt5 used to ignore invalid textual offsets but Qt6 rejects those, so handle that explictly
     if (!kdt.isValid()) {
@@ -102,9 +506,7 @@ QString dateTimeToString(uint date)
 
 QString calcMD5Sum(const QString &str)
 {
-    md5Machine.reset();
-    md5Machine.addData(str.toUtf8());
-    return QLatin1String(md5Machine.result().toHex().constData());
+    return QLatin1String(QCryptographicHash::hash(str.toUtf8(), QCryptographicHash::Md5).toHex().constData());
 }
 
 QString resolveEntities(const QString &str)
@@ -112,15 +514,92 @@ QString resolveEntities(const QString &str)
     return KCharsets::resolveEntities(str);
 }
 
+QString escapeText(QStringView str, TextEscapeOptions options)
+{
+    const bool resolve = options.testFlag(ResolveEntities);
+    const bool newlines = options.testFlag(ConvertNewlines);
+    const bool allCharacters = !options.testFlag(PlainTextToHtml);
+
+    QString out;
+    out.reserve(str.size() + str.size() / 8);
+
+    // out is trimmed to trimmedEnd at the end; leading whitespace is dropped
+    // as long as out is empty
+    qsizetype trimmedEnd = 0;
+
+    // the last '&' that might start an entity, and the state before it
+    qsizetype ampersand = -1;
+    qsizetype ampersandOut = 0;
+    qsizetype ampersandTrimmedEnd = 0;
+
+    const auto append = [&](QChar c) {
+        const bool trim = c.isSpace() && !(c == u'\n' && newlines && !allCharacters);
+        if (trim && out.isEmpty()) {
+            return;
+        }
+        switch (c.unicode()) {
+        case u'&':
+            out.append(QLatin1String("&amp;"));
+            break;
+        case u'"':
+            out.append(QLatin1String("&quot;"));
+            break;
+        case u'<':
+            out.append(QLatin1String("&lt;"));
+            break;
+        case u'>':
+            out.append(allCharacters ? QLatin1String("&gt;") : QLatin1String(">"));
+            break;
+        case u'\'':
+            out.append(allCharacters ? QLatin1String("&apos;") : QLatin1String("'"));
+            break;
+        case u'\n':
+            if (newlines) {
+                out.append(QLatin1String("<br/>"));
+            } else {
+                out.append(c);
+            }
+            break;
+        default:
+            out.append(c);
+            break;
+        }
+        if (!trim) {
+            trimmedEnd = out.size();
+        }
+    };
+
+    for (qsizetype i = 0; i < str.size(); ++i) {
+        const QChar c = str.at(i);
+        if (resolve) {
+            // same rules as KCharsets::resolveEntities(): an entity runs from the
+            // last '&' to the next ';', and resolved characters are not rescanned
+            if (c == u'&') {
+                ampersand = i;
+                ampersandOut = out.size();
+                ampersandTrimmedEnd = trimmedEnd;
+            } else if (c == u';' && ampersand != -1) {
+                const QStringView entity = str.mid(ampersand + 1, i - ampersand - 1);
+                const QChar value = entity.isEmpty() ? QChar() : KCharsets::fromEntity(entity);
+                ampersand = -1;
+                if (!value.isNull()) {
+                    out.truncate(ampersandOut);
+                    trimmedEnd = ampersandTrimmedEnd;
+                    append(value);
+                    continue;
+                }
+            }
+        }
+        append(c);
+    }
+
+    out.truncate(trimmedEnd);
+    return out;
+}
+
 QString escapeSpecialCharacters(const QString &strp)
 {
-    QString str(strp);
-    str.replace(QLatin1Char('&'), QLatin1String("&amp;"));
-    str.replace(QLatin1Char('\"'), QLatin1String("&quot;"));
-    str.replace(QLatin1Char('<'), QLatin1String("&lt;"));
-    str.replace(QLatin1Char('>'), QLatin1String("&gt;"));
-    str.replace(QLatin1Char('\''), QLatin1String("&apos;"));
-    return str.trimmed();
+    return escapeText(strp);
 }
 
 QString convertNewlines(const QString &strp)
@@ -132,58 +611,105 @@ QString convertNewlines(const QString &strp)
 
 QString plainTextToHtml(const QString &plainText)
 {
-    QString str(plainText);
-    str.replace(QLatin1Char('&'), QLatin1String("&amp;"));
-    str.replace(QLatin1Char('\"'), QLatin1String("&quot;"));
-    str.replace(QLatin1Char('<'), QLatin1String("&lt;"));
-    // str.replace(QLatin1Char('>'), QLatin1String("&gt;"));
-    str.replace(QLatin1Char('\n'), QLatin1String("<br/>"));
-    return str.trimmed();
+    return escapeText(plainText, ConvertNewlines | PlainTextToHtml);
 }
 
 QString htmlToPlainText(const QString &html)
 {
-    QString str(html);
     // TODO: preserve some formatting, such as line breaks
-    str.remove(QRegularExpression(QStringLiteral("<[^>]*?>"))); // remove tags
+    // remove tags: everything from a '<' to the next '>'
+    QString str;
+    qsizetype pos = 0;
+    while (true) {
+        const qsizetype open = html.indexOf(QLatin1Char('<'), pos);
+        const qsizetype close = open == -1 ? -1 : html.indexOf(QLatin1Char('>'), open + 1);
+        if (close == -1) {
+            break;
+        }
+        if (str.isNull()) {
+            str.reserve(html.size());
+        }
+        str.append(QStringView(html).mid(pos, open - pos));
+        pos = close + 1;
+    }
+    if (str.isNull()) {
+        str = html;
+    } else {
+        str.append(QStringView(html).mid(pos));
+    }
     str = resolveEntities(str);
     return str.trimmed();
 }
 
-static QRegularExpression tagRegExp()
+namespace
 {
-    static QRegularExpression exp(QStringLiteral("<\\w+.*/?>"));
-    return exp;
+// \w of QRegularExpression without UseUnicodePropertiesOption, i.e. [a-zA-Z0-9_]
+bool isWordCharacter(QChar c)
+{
+    const char16_t u = c.unicode();
+    return (u >= u'a' && u <= u'z') || (u >= u'A' && u <= u'Z') || (u >= u'0' && u <= u'9') || u == u'_';
 }
 
-bool stringContainsMarkup(const QString &str)
+bool isEntityCharacter(QChar c)
 {
-    // check for entities
-    if (str.contains(QRegularExpression(QStringLiteral("&[a-zA-Z0-9#]+;")))) {
-        return true;
-    }
+    const char16_t u = c.unicode();
+    return (u >= u'a' && u <= u'z') || (u >= u'A' && u <= u'Z') || (u >= u'0' && u <= u'9') || u == u'#';
+}
 
-    const int ltc = str.count(QLatin1Char('<'));
-    if (ltc == 0) {
-        return false;
+// Looks for an entity ("&[a-zA-Z0-9#]+;") or something looking like a tag
+// ("<\w+.*/?>", where '.' does not match line breaks) in a single pass.
+bool containsMarkup(QStringView str)
+{
+    const qsizetype size = str.size();
+    bool inTag = false;
+    for (qsizetype i = 0; i < size; ++i) {
+        const char16_t c = str.at(i).unicode();
+        // none of the characters of interest is above '>'
+        if (c > u'>') {
+            continue;
+        }
+        switch (c) {
+        case u'&': {
+            qsizetype j = i + 1;
+            while (j < size && isEntityCharacter(str.at(j))) {
+                ++j;
+            }
+            if (j > i + 1 && j < size && str.at(j) == u';') {
+                return true;
+            }
+            // skipped characters are neither of the ones we look for
+            i = j - 1;
+            break;
+        }
+        case u'<':
+            if (i + 1 < size) {
+                inTag = inTag || isWordCharacter(str.at(i + 1));
+            }
+            break;
+        case u'>':
+            if (inTag) {
+                return true;
+            }
+            break;
+        case u'\n':
+            inTag = false;
+            break;
+        default:
+            break;
+        }
     }
+    return false;
+}
+} // namespace
 
-    return str.contains(tagRegExp());
+bool stringContainsMarkup(const QString &str)
+{
+    return containsMarkup(str);
 }
 
 bool isHtml(const QString &str)
 {
-    // check for entities
-    if (str.contains(QRegularExpression(QStringLiteral("&[a-zA-Z0-9#]+;")))) {
-        return true;
-    }
-
-    const int ltc = str.count(QLatin1Char('<'));
-    if (ltc == 0) {
-        return false;
-    }
-
-    return str.contains(tagRegExp());
+    return containsMarkup(str);
 }
 
 QString normalize(const QString &str)
@@ -195,19 +721,53 @@ QString normalize(const QString &strp, bool isCDATA, bool containsMarkup)
 {
     if (containsMarkup) {
         return strp.trimmed();
+    } else if (isCDATA) {
+        return escapeText(strp, ResolveEntities | ConvertNewlines);
     } else {
-        if (isCDATA) {
-            QString str = resolveEntities(strp);
-            str = escapeSpecialCharacters(str);
-            str = convertNewlines(str);
-            str = str.trimmed();
-            return str;
-        } else {
-            QString str = escapeSpecialCharacters(strp);
-            str = str.trimmed();
-            return str;
+        return escapeText(strp);
+    }
+}
+
+// \s of QRegularExpression without UseUnicodePropertiesOption, so e.g. a
+// no-break space does not separate an address from the text around it
+static bool isAsciiSpace(QChar c)
+{
+    const char16_t u = c.unicode();
+    return u == u' ' || (u >= u'\t' && u <= u'\r'); // \t, \n, \v, \f, \r
+}
+
+// Finds the first match of "<?([^@\s<]+@[^>\s]+)>?" in str, returning the
+// whole match and storing the address without the angle brackets in email
+static QStringView findMailAddress(QStringView str, QString *email)
+{
+    const qsizetype size = str.size();
+    qsizetype start = 0; // start of the run of characters before the current '@'
+    for (qsizetype i = 0; i < size; ++i) {
+        const QChar c = str.at(i);
+        if (c == QLatin1Char('<') || isAsciiSpace(c)) {
+            start = i + 1;
+            continue;
         }
+        if (c != QLatin1Char('@')) {
+            continue;
+        }
+        if (i == start) {
+            start = i + 1;
+            continue;
+        }
+        qsizetype end = i + 1;
+        while (end < size && str.at(end) != QLatin1Char('>') && !isAsciiSpace(str.at(end))) {
+            ++end;
+        }
+        if (end > i + 1) {
+            *email = str.mid(start, end - start).toString();
+            const qsizetype matchStart = start > 0 && str.at(start - 1) == QLatin1Char('<') ? start - 1 : start;
+            const qsizetype matchEnd = end < size && str.at(end) == QLatin1Char('>') ? end + 1 : end;
+            return str.mid(matchStart, matchEnd - matchStart);
+        }
+        start = i + 1;
     }
+    return QStringView();
 }
 
 PersonPtr personFromString(const QString &strp)
@@ -224,20 +784,17 @@ PersonPtr personFromString(const QString &strp)
 
     // look for something looking like a mail address ("foo@bar.com",
     // "<foo@bar.com>") and extract it
+    // FIXME: use a "proper" address parser, search kmail source for it
 
-    const QRegularExpression remail(QStringLiteral("<?([^@\\s<]+@[^>\\s]+)>?")); // FIXME: user "proper" regexp,
-    // search kmail source for it
-
-    QRegularExpressionMatch match = remail.match(str);
-    if (match.hasMatch()) {
-        const QString all = match.captured(0);
-        email = match.captured(1);
-        str.remove(all); // remove mail address
+    const QStringView all = findMailAddress(str, &email);
+    if (!all.isEmpty()) {
+        str.remove(all.toString()); // remove mail address
     }
 
     // replace "mailto", "(", ")" (to be extended)
     email.remove(QStringLiteral("mailto:"));
-    email.remove(QRegularExpression(QStringLiteral("[()]")));
+    email.remove(QLatin1Char('('));
+    email.remove(QLatin1Char(')'));
 
     // simplify the rest and use it as name
 
@@ -249,10 +806,8 @@ PersonPtr personFromString(const QString &strp)
     // str is of the format "Foo M. Bar (President)",
     // we should not cut anything.
 
-    QRegularExpression rename(QRegularExpression::anchoredPattern(QStringLiteral("^\\(([^)]*)\\)")));
-    match = rename.match(name);
-    if (match.hasMatch()) {
-        name = match.captured(1);
+    if (name.startsWith(QLatin1Char('(')) && name.indexOf(QLatin1Char(')')) == name.size() - 1) {
+        name = name.mid(1, name.size() - 2);
     }
 
     name = name.isEmpty() ? QString() : name;
@@ -46,6 +46,9 @@ uint parseISODate(const QString &str);
  * parses a date string as defined in RFC 822.
  * (Sat, 07 Sep 2002 00:00:01 GMT)
  *
+ * Besides numeric offsets, the textual zones of RFC 822 (GMT, UT, the
+ * US zones like EST or PDT and the military ones) are understood.
+ *
  * \a str a string in RFC 822 format
  *
  * Returns parsed date in seconds since epoch, 0 if no date could
@@ -214,6 +217,13 @@ unsigned int calcHash(const QString &str);
  */
 unsigned int calcHash(const QByteArray &array);
 
+/*!
+ * \internal
+ * calculates a 64 bit digest of a byte array (XXH64), to tell documents
+ * apart by their content
+ */
+quint64 calcDigest(const QByteArray &array);
+
 /*!
  * \internal
  * calculates a md5 checksum for a string
@@ -0,0 +1,163 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "xmlsubtreewriter_p.h"
+
+#include <constants.h>
+
+#include <QUrl>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
+namespace Syndication
+{
+//@cond PRIVATE
+void XmlScopeStack::push(const QXmlStreamReader &reader)
+{
+    Scope scope = m_scopes.isEmpty() ? Scope() : m_scopes.last();
+
+    const QXmlStreamNamespaceDeclarations declarations = reader.namespaceDeclarations();
+    for (const QXmlStreamNamespaceDeclaration &declaration : declarations) {
+        scope.namespaces.insert(declaration.prefix().toString(), declaration.namespaceUri().toString());
+    }
+
+    const QXmlStreamAttributes attributes = reader.attributes();
+    const QString xmlNs = xmlNamespace();
+    if (attributes.hasAttribute(xmlNs, QStringLiteral("base"))) {
+        // resolved the same way as ElementWrapper::xmlBase()
+        scope.xmlBase = QUrl(scope.xmlBase).resolved(QUrl(attributes.value(xmlNs, QStringLiteral("base")).toString())).url();
+    }
+    if (attributes.hasAttribute(xmlNs, QStringLiteral("lang"))) {
+        scope.xmlLang = attributes.value(xmlNs, QStringLiteral("lang")).toString();
+    }
+
+    m_scopes.append(scope);
+}
+
+void XmlScopeStack::pop()
+{
+    if (!m_scopes.isEmpty()) {
+        m_scopes.removeLast();
+    }
+}
+
+int XmlScopeStack::depth() const
+{
+    return m_scopes.count();
+}
+
+const XmlScopeStack::Scope &XmlScopeStack::current() const
+{
+    static const Scope empty;
+    return m_scopes.isEmpty() ? empty : m_scopes.last();
+}
+
+XmlSubtreeWriter::XmlSubtreeWriter()
+{
+}
+
+XmlSubtreeWriter::~XmlSubtreeWriter()
+{
+}
+
+void XmlSubtreeWriter::start(const QXmlStreamReader &reader, const XmlScopeStack &scopes, bool inheritContext)
+{
+    m_buffer.clear();
+    m_writer.reset(new QXmlStreamWriter(&m_buffer));
+    m_depth = 1;
+    writeStartElement(reader, true, inheritContext, scopes.current());
+}
+
+bool XmlSubtreeWriter::write(const QXmlStreamReader &reader)
+{
+    if (!m_writer) {
+        return false;
+    }
+
+    switch (reader.tokenType()) {
+    case QXmlStreamReader::StartElement:
+        ++m_depth;
+        writeStartElement(reader, false, false, XmlScopeStack::Scope());
+        break;
+    case QXmlStreamReader::EndElement:
+        m_writer->writeEndElement();
+        return --m_depth == 0;
+    case QXmlStreamReader::Characters:
+        if (reader.isCDATA()) {
+            m_writer->writeCDATA(reader.text().toString());
+        } else {
+            m_writer->writeCharacters(reader.text().toString());
+        }
+        break;
+    default:
+        m_writer->writeCurrentToken(reader);
+        break;
+    }
+    return false;
+}
+
+bool XmlSubtreeWriter::isActive() const
+{
+    return m_writer != nullptr;
+}
+
+QString XmlSubtreeWriter::take()
+{
+    m_writer.reset();
+    m_depth = 0;
+    QString xml = m_buffer;
+    m_buffer = QString();
+    return xml;
+}
+
+void XmlSubtreeWriter::writeStartElement(const QXmlStreamReader &reader, bool isRoot, bool inheritContext, const XmlScopeStack::Scope &scope)
+{
+    m_writer->writeStartElement(reader.qualifiedName().toString());
+
+    if (isRoot) {
+        for (auto it = scope.namespaces.cbegin(); it != scope.namespaces.cend(); ++it) {
+            if (it.key().isEmpty()) {
+                if (!it.value().isEmpty()) {
+                    m_writer->writeDefaultNamespace(it.value());
+                }
+            } else {
+                m_writer->writeNamespace(it.value(), it.key());
+            }
+        }
+    } else {
+        const QXmlStreamNamespaceDeclarations declarations = reader.namespaceDeclarations();
+        for (const QXmlStreamNamespaceDeclaration &declaration : declarations) {
+            if (declaration.prefix().isEmpty()) {
+                m_writer->writeDefaultNamespace(declaration.namespaceUri().toString());
+            } else {
+                m_writer->writeNamespace(declaration.namespaceUri().toString(), declaration.prefix().toString());
+            }
+        }
+    }
+
+    const QString xmlNs = xmlNamespace();
+    const QXmlStreamAttributes attributes = reader.attributes();
+    for (const QXmlStreamAttribute &attribute : attributes) {
+        // the root gets the resolved values below instead
+        if (inheritContext && attribute.namespaceUri() == xmlNs && (attribute.name() == QLatin1String("base") || attribute.name() == QLatin1String("lang"))) {
+            continue;
+        }
+        m_writer->writeAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+
+    if (inheritContext) {
+        if (!scope.xmlBase.isEmpty()) {
+            m_writer->writeAttribute(QStringLiteral("xml:base"), scope.xmlBase);
+        }
+        if (!scope.xmlLang.isEmpty()) {
+            m_writer->writeAttribute(QStringLiteral("xml:lang"), scope.xmlLang);
+        }
+    }
+}
+//@endcond
+
+} // namespace Syndication
@@ -0,0 +1,104 @@
+/*
+    This file is part of the syndication library
+    SPDX-FileCopyrightText: 2026 KDE Community
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef SYNDICATION_XMLSUBTREEWRITER_P_H
+#define SYNDICATION_XMLSUBTREEWRITER_P_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+
+#include <memory>
+
+class QXmlStreamReader;
+class QXmlStreamWriter;
+
+namespace Syndication
+{
+//@cond PRIVATE
+/*!
+ * \internal
+ *
+ * Tracks the context inherited by the element a QXmlStreamReader is
+ * positioned on: in-scope namespace declarations, the resolved xml:base
+ * and xml:lang. push() must be called for every StartElement and pop()
+ * for every EndElement.
+ */
+class XmlScopeStack
+{
+public:
+    struct Scope {
+        QHash<QString, QString> namespaces; // prefix -> namespace URI
+        QString xmlBase;
+        QString xmlLang;
+    };
+
+    void push(const QXmlStreamReader &reader);
+    void pop();
+
+    int depth() const;
+
+    /*!
+     * the context of the current element, including its own declarations
+     */
+    const Scope &current() const;
+
+private:
+    QList<Scope> m_scopes;
+};
+
+/*!
+ * \internal
+ *
+ * Serializes the subtree of the element a QXmlStreamReader is positioned
+ * on, so it can be parsed again on its own (e.g. into a small
+ * QDomDocument). Prefixes are kept as written. The root element of the
+ * copy carries all namespace declarations in scope as well as the
+ * resolved xml:base and the inherited xml:lang, so relative links and
+ * language lookups give the same results as in the full document.
+ */
+class XmlSubtreeWriter
+{
+public:
+    XmlSubtreeWriter();
+    ~XmlSubtreeWriter();
+
+    /*!
+     * starts a copy at the current StartElement of \a reader. \a scopes
+     * must already contain the scope of that element.
+     *
+     * If \a inheritContext is \c false, the root keeps its own xml:base
+     * and xml:lang attributes, for copies that are inserted below an
+     * element providing the context again.
+     */
+    void start(const QXmlStreamReader &reader, const XmlScopeStack &scopes, bool inheritContext = true);
+
+    /*!
+     * copies the current token of \a reader
+     * Returns \c true if the token closed the root element of the copy
+     */
+    bool write(const QXmlStreamReader &reader);
+
+    bool isActive() const;
+
+    /*!
+     * ends the copy and returns the serialized XML
+     */
+    QString take();
+
+private:
+    void writeStartElement(const QXmlStreamReader &reader, bool isRoot, bool inheritContext, const XmlScopeStack::Scope &scope);
+
+    QString m_buffer;
+    std::unique_ptr<QXmlStreamWriter> m_writer;
+    int m_depth = 0;
+};
+//@endcond
+
+} // namespace Syndication
+
+#endif // SYNDICATION_XMLSUBTREEWRITER_P_H